@@ -0,0 +1,73 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Portable aligned allocation. MSVC uses the _aligned_* CRT functions, other
+// platforms posix_memalign with the original pointer stored just before the
+// returned block, so both flavours release through aligned_free.
+
+#ifndef CLUSTERBENCH_ALIGNED_ALLOC
+#define CLUSTERBENCH_ALIGNED_ALLOC
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+namespace sw {
+
+// p + alignmentOffset is aligned, alignment must be a power of two
+inline void* aligned_offset_malloc(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+#if defined(_MSC_VER)
+    return _aligned_offset_malloc(n, alignment, alignmentOffset % alignment);
+#else
+    if(alignment < sizeof(void*)){
+        alignment = sizeof(void*);
+    }
+    alignmentOffset %= alignment;
+
+    // room for the original pointer then up to one alignment of shift
+    std::size_t header = (sizeof(void*) + alignment - 1) & ~(alignment - 1);
+    void* base = nullptr;
+    if(posix_memalign(&base, alignment, header + alignment + n) != 0){
+        return nullptr;
+    }
+
+    std::uintptr_t p = reinterpret_cast<std::uintptr_t>(base) + header;
+    p += (alignment - alignmentOffset) % alignment;
+    // p is only pointer aligned when alignmentOffset is a multiple of it
+    std::memcpy(reinterpret_cast<void*>(p - sizeof(void*)), &base, sizeof(void*));
+    return reinterpret_cast<void*>(p);
+#endif
+}
+
+inline void* aligned_malloc(std::size_t n, std::size_t alignment){
+#if defined(_MSC_VER)
+    return _aligned_malloc(n, alignment);
+#else
+    return aligned_offset_malloc(n, alignment, 0);
+#endif
+}
+
+inline void aligned_free(void* p){
+#if defined(_MSC_VER)
+    _aligned_free(p);
+#else
+    if(p != nullptr){
+        void* base;
+        std::memcpy(&base, static_cast<char*>(p) - sizeof(void*), sizeof(void*));
+        std::free(base);
+    }
+#endif
+}
+
+} //end of namespace sw
+
+#endif
@@ -0,0 +1,690 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Chunk allocators for the Cluster containers. They implement the same
+// interface as sw::default_allocator: allocate(n), allocate(n, alignment,
+// alignmentOffset) and deallocate(p, n), where p + alignmentOffset is aligned
+// and alignment is a power of two. The containers default construct their
+// allocator, so the state of each allocator is shared by all its instances.
+
+#ifndef CLUSTERBENCH_ALLOCATORS
+#define CLUSTERBENCH_ALLOCATORS
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "aligned_alloc.hpp"
+
+namespace sw {
+
+namespace detail {
+
+inline std::byte* align_with_offset(std::byte* p, std::size_t alignment, std::size_t alignmentOffset){
+    std::uintptr_t target = reinterpret_cast<std::uintptr_t>(p) + alignmentOffset;
+    target = (target + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    return reinterpret_cast<std::byte*>(target - alignmentOffset);
+}
+
+} //end of namespace detail
+
+// Monotonic arena: allocations bump a pointer through large blocks and
+// deallocations are free. Once every allocation has been released the arena
+// rewinds to its first block, keeping the blocks for the next fill. Not
+// thread safe.
+class arena_allocator {
+    public:
+        static constexpr std::size_t block_size = 16u << 20;
+
+        void* allocate(std::size_t n){
+            return allocate(n, alignof(std::max_align_t), 0);
+        }
+
+        void* allocate(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+            arena& a = state();
+            ++a.live;
+            return a.bump(n, alignment, alignmentOffset % alignment);
+        }
+
+        void deallocate(void*, std::size_t){
+            arena& a = state();
+            if(--a.live == 0){
+                a.rewind();
+            }
+        }
+
+    private:
+        struct block {
+            std::unique_ptr<std::byte[]> memory;
+            std::size_t size;
+        };
+
+        struct arena {
+            std::vector<block> blocks;
+            std::size_t used = 0;
+            std::byte* top = nullptr;
+            std::byte* end = nullptr;
+            std::size_t live = 0;
+
+            void* bump(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+                std::byte* p = top != nullptr ? detail::align_with_offset(top, alignment, alignmentOffset) : nullptr;
+                if(p == nullptr || p + n > end){
+                    // the next kept block if it is large enough, a new one otherwise
+                    std::size_t needed = n + alignment;
+                    if(used == blocks.size() || blocks[used].size < needed){
+                        std::size_t size = std::max(block_size, needed);
+                        blocks.insert(blocks.begin() + used, block{ std::unique_ptr<std::byte[]>(new std::byte[size]), size });
+                    }
+
+                    top = blocks[used].memory.get();
+                    end = top + blocks[used].size;
+                    ++used;
+                    p = detail::align_with_offset(top, alignment, alignmentOffset);
+                }
+
+                top = p + n;
+                return p;
+            }
+
+            void rewind(){
+                used = 0;
+                top = end = nullptr;
+            }
+        };
+
+        static arena& state(){
+            static arena a;
+            return a;
+        }
+};
+
+// Pool of BlockSize byte blocks carved out of slabs of SlabBlocks blocks.
+// Blocks are recycled through a lock free stack of block indices, tagged
+// against ABA like concurrent_cluster_map; the mutex is only taken to carve
+// a new slab. Requests that do not fit a block go to aligned_offset_malloc.
+template<std::size_t BlockSize = 64 * 1024, std::size_t SlabBlocks = 64>
+class pool_allocator {
+    static_assert((BlockSize & (BlockSize - 1)) == 0, "BlockSize must be a power of two");
+    static_assert(BlockSize >= sizeof(std::atomic<std::uint32_t>), "BlockSize too small");
+
+    public:
+        static constexpr std::size_t max_slabs = 4096;
+
+        void* allocate(std::size_t n){
+            return allocate(n, alignof(std::max_align_t), 0);
+        }
+
+        void* allocate(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+            // blocks are BlockSize aligned, an offset costs up to one alignment
+            std::size_t shift = (alignment - alignmentOffset % alignment) % alignment;
+            if(alignment > BlockSize || n + shift > BlockSize){
+                return aligned_offset_malloc(n, alignment, alignmentOffset % alignment);
+            }
+
+            return state().pop() + shift;
+        }
+
+        void deallocate(void* p, std::size_t){
+            if(!state().push(static_cast<std::byte*>(p))){
+                aligned_free(p);
+            }
+        }
+
+    private:
+        static constexpr std::uint32_t empty_block = 0xFFFFFFFFu;
+        static constexpr std::size_t slab_bytes = BlockSize * SlabBlocks;
+
+        struct pool {
+            std::atomic<std::byte*> slabs[max_slabs] = {};
+            std::atomic<std::size_t> slab_count{0};
+            std::atomic<std::uint64_t> free_head{empty_block};
+            std::mutex growth;
+
+            ~pool(){
+                for(std::size_t i = 0; i < slab_count.load(); ++i){
+                    aligned_free(slabs[i].load());
+                }
+            }
+
+            std::byte* block(std::uint32_t index) const {
+                return slabs[index / SlabBlocks].load(std::memory_order_acquire) + (index % SlabBlocks) * BlockSize;
+            }
+
+            std::atomic<std::uint32_t>& next(std::uint32_t index) const {
+                return *reinterpret_cast<std::atomic<std::uint32_t>*>(block(index));
+            }
+
+            static std::uint64_t next_tag(std::uint64_t head){
+                return ((head >> 32) + 1) << 32;
+            }
+
+            std::byte* pop(){
+                while(true){
+                    std::uint64_t head = free_head.load(std::memory_order_acquire);
+                    while(static_cast<std::uint32_t>(head) != empty_block){
+                        // a stale next read from a block popped meanwhile is
+                        // rejected by the tag of the compare exchange
+                        std::uint32_t index = static_cast<std::uint32_t>(head);
+                        std::uint32_t after = next(index).load(std::memory_order_relaxed);
+                        if(free_head.compare_exchange_weak(head, next_tag(head) | after, std::memory_order_acquire, std::memory_order_acquire)){
+                            return block(index);
+                        }
+                    }
+
+                    grow();
+                }
+            }
+
+            // false when p was not carved from a slab
+            bool push(std::byte* p){
+                std::size_t count = slab_count.load(std::memory_order_acquire);
+                for(std::size_t slab = 0; slab < count; ++slab){
+                    std::byte* first = slabs[slab].load(std::memory_order_relaxed);
+                    if(p >= first && p < first + slab_bytes){
+                        std::uint32_t index = static_cast<std::uint32_t>(slab * SlabBlocks + (p - first) / BlockSize);
+                        link(index, index);
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            // push the chain of blocks first..last, already linked together
+            void link(std::uint32_t first, std::uint32_t last){
+                std::uint64_t head = free_head.load(std::memory_order_relaxed);
+                do {
+                    next(last).store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+                } while(!free_head.compare_exchange_weak(head, next_tag(head) | first, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            void grow(){
+                std::lock_guard<std::mutex> lock(growth);
+                if(static_cast<std::uint32_t>(free_head.load(std::memory_order_acquire)) != empty_block){
+                    return;
+                }
+
+                std::size_t slab = slab_count.load(std::memory_order_relaxed);
+                if(slab == max_slabs){
+                    throw std::bad_alloc();
+                }
+
+                std::byte* memory = static_cast<std::byte*>(aligned_malloc(slab_bytes, BlockSize));
+                if(memory == nullptr){
+                    throw std::bad_alloc();
+                }
+                slabs[slab].store(memory, std::memory_order_release);
+                slab_count.store(slab + 1, std::memory_order_release);
+
+                std::uint32_t first = static_cast<std::uint32_t>(slab * SlabBlocks);
+                for(std::uint32_t i = 0; i + 1 < SlabBlocks; ++i){
+                    new (block(first + i)) std::atomic<std::uint32_t>(first + i + 1);
+                }
+                new (block(first + SlabBlocks - 1)) std::atomic<std::uint32_t>(empty_block);
+                link(first, static_cast<std::uint32_t>(first + SlabBlocks - 1));
+            }
+        };
+
+        static pool& state(){
+            static pool p;
+            return p;
+        }
+};
+
+// Caches freed blocks per thread and per size, so that a thread refilling a
+// container reuses its own chunks without touching the global heap. Misses
+// and overflows go to aligned_offset_malloc and aligned_free, so blocks
+// may be freed from any thread.
+class thread_cache_allocator {
+    public:
+        static constexpr std::size_t max_sizes = 16;
+        static constexpr std::size_t max_blocks = 64;
+
+        void* allocate(std::size_t n){
+            return allocate(n, alignof(std::max_align_t), 0);
+        }
+
+        void* allocate(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+            alignmentOffset %= alignment;
+            for(auto& bucket : state().buckets){
+                if(bucket.size == n && !bucket.blocks.empty()){
+                    std::byte* p = static_cast<std::byte*>(bucket.blocks.back());
+                    if(detail::align_with_offset(p, alignment, alignmentOffset) == p){
+                        bucket.blocks.pop_back();
+                        return p;
+                    }
+                    break;
+                }
+            }
+
+            return aligned_offset_malloc(n, alignment, alignmentOffset);
+        }
+
+        void deallocate(void* p, std::size_t n){
+            cache& c = state();
+            for(auto& bucket : c.buckets){
+                if(bucket.size == n){
+                    if(bucket.blocks.size() < max_blocks){
+                        bucket.blocks.push_back(p);
+                        return;
+                    }
+                    aligned_free(p);
+                    return;
+                }
+            }
+
+            if(c.buckets.size() < max_sizes){
+                c.buckets.push_back(bucket_type{ n, { p } });
+                return;
+            }
+
+            aligned_free(p);
+        }
+
+    private:
+        struct bucket_type {
+            std::size_t size;
+            std::vector<void*> blocks;
+        };
+
+        struct cache {
+            std::vector<bucket_type> buckets;
+
+            ~cache(){
+                for(auto& bucket : buckets){
+                    for(void* p : bucket.blocks){
+                        aligned_free(p);
+                    }
+                }
+            }
+        };
+
+        static cache& state(){
+            thread_local cache c;
+            return c;
+        }
+};
+
+enum class page_size {
+    PAGES_4K, // transparent huge pages disabled
+    PAGES_2M
+};
+
+// Carves the requests out of regions mapped from the OS with the chosen page
+// size, so that chunks of any size land on huge pages with PAGES_2M and small
+// chunks share them. A region is unmapped once its last allocation has been
+// released; requests of a quarter of a region or more get a mapping of their
+// own. PAGES_2M asks for MAP_HUGETLB pages and falls back to transparent huge
+// pages through madvise when none are reserved. Mappings are rounded to 2 MiB
+// and start 2 MiB aligned in both modes, so only the page size differs.
+// Windows maps with VirtualAlloc and MEM_LARGE_PAGES, which needs the lock
+// pages in memory privilege. Not thread safe.
+template<page_size Pages>
+class page_allocator {
+    public:
+        static constexpr std::size_t huge_page = 2u << 20;
+        static constexpr std::size_t region_size = 16 * huge_page;
+        static constexpr std::size_t mapping_threshold = region_size / 4;
+        // largest alignment of a request, the mapping base of a request with
+        // a mapping of its own is found back by rounding the block down to it
+        static constexpr std::size_t max_alignment = 64u << 10;
+
+        void* allocate(std::size_t n){
+            return allocate(n, alignof(std::max_align_t), 0);
+        }
+
+        void* allocate(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+            if(alignment > max_alignment){
+                throw std::bad_alloc();
+            }
+            alignmentOffset %= alignment;
+
+            if(n < mapping_threshold){
+                return state().carve(n, alignment, alignmentOffset);
+            }
+
+            std::size_t shift = (alignment - alignmentOffset) % alignment;
+            return map(length(n, shift != 0)) + shift;
+        }
+
+        void deallocate(void* p, std::size_t n){
+            if(n < mapping_threshold){
+                state().release(static_cast<std::byte*>(p));
+                return;
+            }
+
+            std::byte* base = reinterpret_cast<std::byte*>(reinterpret_cast<std::uintptr_t>(p) & ~(static_cast<std::uintptr_t>(max_alignment) - 1));
+            unmap(base, length(n, base != p));
+        }
+
+    private:
+        struct region {
+            std::byte* base;
+            std::size_t live;
+        };
+
+        struct regions {
+            // by base address, to find the region of a released block
+            std::map<std::uintptr_t, region> mapped;
+            region* current = nullptr;
+            std::byte* top = nullptr;
+
+            ~regions(){
+                for(auto& r : mapped){
+                    unmap(r.second.base, region_size);
+                }
+            }
+
+            void* carve(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+                std::byte* p = current != nullptr ? detail::align_with_offset(top, alignment, alignmentOffset) : nullptr;
+                if(p == nullptr || p + n > current->base + region_size){
+                    // the current region is left to its live blocks
+                    if(current == nullptr || current->live != 0){
+                        std::byte* base = map(region_size);
+                        current = &mapped.emplace(reinterpret_cast<std::uintptr_t>(base), region{ base, 0 }).first->second;
+                    }
+
+                    p = detail::align_with_offset(current->base, alignment, alignmentOffset);
+                }
+
+                ++current->live;
+                top = p + n;
+                return p;
+            }
+
+            void release(std::byte* p){
+                auto it = std::prev(mapped.upper_bound(reinterpret_cast<std::uintptr_t>(p)));
+                region& r = it->second;
+                if(--r.live != 0){
+                    return;
+                }
+
+                if(&r == current){
+                    top = r.base;
+                } else {
+                    unmap(r.base, region_size);
+                    mapped.erase(it);
+                }
+            }
+        };
+
+        static regions& state(){
+            static regions r;
+            return r;
+        }
+
+        static std::size_t length(std::size_t n, bool shifted){
+            std::size_t bytes = n + (shifted ? max_alignment : 0);
+            return (bytes + huge_page - 1) & ~(huge_page - 1);
+        }
+
+#if defined(_WIN32)
+        static std::byte* map(std::size_t bytes){
+            void* p = nullptr;
+            if(Pages == page_size::PAGES_2M){
+                p = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            }
+            if(p == nullptr){
+                p = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            }
+            if(p == nullptr){
+                throw std::bad_alloc();
+            }
+            return static_cast<std::byte*>(p);
+        }
+
+        static void unmap(std::byte* base, std::size_t){
+            VirtualFree(base, 0, MEM_RELEASE);
+        }
+#else
+        // over-map by one huge page and trim to a 2 MiB aligned range
+        static std::byte* map_aligned(std::size_t bytes){
+            void* raw = mmap(nullptr, bytes + huge_page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(raw == MAP_FAILED){
+                throw std::bad_alloc();
+            }
+
+            std::byte* first = static_cast<std::byte*>(raw);
+            std::byte* base = reinterpret_cast<std::byte*>((reinterpret_cast<std::uintptr_t>(first) + huge_page - 1) & ~(static_cast<std::uintptr_t>(huge_page) - 1));
+            if(base != first){
+                munmap(first, base - first);
+            }
+            munmap(base + bytes, (first + bytes + huge_page) - (base + bytes));
+            return base;
+        }
+
+        static std::byte* map(std::size_t bytes){
+            if(Pages == page_size::PAGES_2M){
+#if defined(MAP_HUGETLB)
+                void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if(p != MAP_FAILED){
+                    return static_cast<std::byte*>(p);
+                }
+#endif
+                std::byte* base = map_aligned(bytes);
+#if defined(MADV_HUGEPAGE)
+                madvise(base, bytes, MADV_HUGEPAGE);
+#endif
+                return base;
+            }
+
+            std::byte* base = map_aligned(bytes);
+#if defined(MADV_NOHUGEPAGE)
+            madvise(base, bytes, MADV_NOHUGEPAGE);
+#endif
+            return base;
+        }
+
+        static void unmap(std::byte* base, std::size_t bytes){
+            munmap(base, bytes);
+        }
+#endif
+};
+
+// Bump allocator over one region whose pages are faulted in up front by
+// reserve(), with MAP_POPULATE where available and by touching every page
+// otherwise, so a timed region using it takes no first touch faults.
+// Deallocation is free and the region rewinds once every allocation has been
+// released; requests past its end go to aligned_offset_malloc. Not thread
+// safe.
+class prefault_allocator {
+    public:
+        static constexpr std::size_t page = 4096;
+
+        // Make sure at least bytes of faulted in memory are available, only
+        // call while nothing is allocated
+        static void reserve(std::size_t bytes){
+            region& r = state();
+            bytes = (bytes + page - 1) & ~(page - 1);
+            if(bytes > r.size){
+                r.release();
+                r.map(bytes);
+            }
+            r.top = r.first;
+        }
+
+        void* allocate(std::size_t n){
+            return allocate(n, alignof(std::max_align_t), 0);
+        }
+
+        void* allocate(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+            region& r = state();
+            if(r.first != nullptr){
+                std::byte* p = detail::align_with_offset(r.top, alignment, alignmentOffset % alignment);
+                if(p + n <= r.first + r.size){
+                    ++r.live;
+                    r.top = p + n;
+                    return p;
+                }
+            }
+
+            return aligned_offset_malloc(n, alignment, alignmentOffset);
+        }
+
+        void deallocate(void* p, std::size_t){
+            region& r = state();
+            if(p >= r.first && p < r.first + r.size){
+                if(--r.live == 0){
+                    r.top = r.first;
+                }
+                return;
+            }
+
+            aligned_free(p);
+        }
+
+    private:
+        struct region {
+            std::byte* first = nullptr;
+            std::byte* top = nullptr;
+            std::size_t size = 0;
+            std::size_t live = 0;
+
+            ~region(){
+                release();
+            }
+
+#if defined(_WIN32)
+            void map(std::size_t bytes){
+                first = static_cast<std::byte*>(VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+                if(first == nullptr){
+                    throw std::bad_alloc();
+                }
+                touch(bytes);
+            }
+
+            void release(){
+                if(first != nullptr){
+                    VirtualFree(first, 0, MEM_RELEASE);
+                }
+                first = top = nullptr;
+                size = 0;
+            }
+#else
+            void map(std::size_t bytes){
+                int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_POPULATE)
+                flags |= MAP_POPULATE;
+#endif
+                void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+                if(p == MAP_FAILED){
+                    throw std::bad_alloc();
+                }
+                first = static_cast<std::byte*>(p);
+#if !defined(MAP_POPULATE)
+                touch(bytes);
+#endif
+                size = bytes;
+            }
+
+            void release(){
+                if(first != nullptr){
+                    munmap(first, size);
+                }
+                first = top = nullptr;
+                size = 0;
+            }
+#endif
+
+            void touch(std::size_t bytes){
+                for(std::size_t offset = 0; offset < bytes; offset += page){
+                    static_cast<volatile std::byte*>(first)[offset] = std::byte{0};
+                }
+                size = bytes;
+            }
+        };
+
+        static region& state(){
+            static region r;
+            return r;
+        }
+};
+
+// Forwards to std::pmr::get_default_resource(), so cluster containers can be
+// benchmarked on the same memory resources as the std::pmr containers. The
+// default resource must not change while a container holds memory. A small
+// header before each block keeps the size and alignment the resource needs
+// back on deallocation, which the allocator interface does not pass.
+class memory_resource_allocator {
+    public:
+        void* allocate(std::size_t n){
+            return allocate(n, alignof(std::max_align_t), 0);
+        }
+
+        void* allocate(std::size_t n, std::size_t alignment, std::size_t alignmentOffset){
+            alignmentOffset %= alignment;
+
+            header h;
+            h.bytes = sizeof(header) + alignment + n;
+            h.base = static_cast<std::byte*>(std::pmr::get_default_resource()->allocate(h.bytes, alignof(header)));
+
+            std::byte* p = detail::align_with_offset(h.base + sizeof(header), alignment, alignmentOffset);
+            std::memcpy(p - sizeof(header), &h, sizeof(header));
+            return p;
+        }
+
+        void deallocate(void* p, std::size_t){
+            header h;
+            std::memcpy(&h, static_cast<std::byte*>(p) - sizeof(header), sizeof(header));
+            std::pmr::get_default_resource()->deallocate(h.base, h.bytes, alignof(header));
+        }
+
+    private:
+        struct header {
+            std::byte* base;
+            std::size_t bytes;
+        };
+};
+
+// Adapts a chunk allocator to the standard allocator requirements, so std
+// containers can use the same backends
+template<typename T, typename Allocator>
+struct std_allocator {
+    using value_type = T;
+
+    std_allocator() = default;
+
+    template<typename U>
+    std_allocator(const std_allocator<U, Allocator>&) {}
+
+    T* allocate(std::size_t n){
+        return static_cast<T*>(Allocator().allocate(n * sizeof(T), alignof(T), 0));
+    }
+
+    void deallocate(T* p, std::size_t n){
+        Allocator().deallocate(p, n * sizeof(T));
+    }
+};
+
+template<typename T, typename U, typename Allocator>
+bool operator==(const std_allocator<T, Allocator>&, const std_allocator<U, Allocator>&){ return true; }
+
+template<typename T, typename U, typename Allocator>
+bool operator!=(const std_allocator<T, Allocator>&, const std_allocator<U, Allocator>&){ return false; }
+
+} //end of namespace sw
+
+#endif
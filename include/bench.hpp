@@ -9,13 +9,26 @@
 
 #include <chrono>
 
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
 #include "graphs.hpp"
 #include "demangle.hpp"
+#include "counting_allocator.hpp"
+#include "parallel.hpp"
 
 // chrono typedefs
 
 using std::chrono::milliseconds;
 using std::chrono::microseconds;
+using std::chrono::nanoseconds;
 
 using Clock = std::chrono::high_resolution_clock;
 
@@ -36,6 +49,13 @@ inline static void run(Container &container, std::size_t size){
     run<Rest...>(container, size);
 }
 
+// Number of T filling a working set of the given size in MiB, so that the
+// memory bound benchmarks reach the same cache level for every element size
+template<typename T>
+constexpr int working_set(std::size_t mebibytes){
+    return static_cast<int>((mebibytes << 20) / sizeof(T));
+}
+
 // benchmarking procedure
 
 template<typename Container,
@@ -94,6 +114,280 @@ void bench(const std::string& test_name, const std::string& type, const std::ini
     CreatePolicy<Container>::clean();
 }
 
+// frame loop benchmarking procedure
+//
+// A single container is kept alive for FRAMES frames and every frame runs the
+// test policies with a size drawn in [size / 2, size]. One untimed frame at
+// full size is run first so only the steady state is measured.
+
+static const std::size_t FRAMES = 100;
+
+enum class FrameMetric {
+    LATENCY,
+    ALLOCATIONS
+};
+
+template<typename Container,
+         typename DurationUnit,
+         template<class> class ...TestPolicy>
+void bench_frames(const std::string& type, const std::initializer_list<int> &sizes, FrameMetric metric){
+    for(auto size : sizes){
+        // same sequence of frame sizes for every container
+        std::mt19937 generator;
+        std::uniform_int_distribution<std::size_t> distribution(size / 2, size);
+
+        Container container;
+        run<TestPolicy...>(container, size);
+
+        std::size_t total = 0;
+        for(std::size_t frame = 0; frame < FRAMES; ++frame){
+            std::size_t frame_size = distribution(generator);
+            std::size_t allocations = allocation_count();
+
+            Clock::time_point t0 = Clock::now();
+
+            run<TestPolicy...>(container, frame_size);
+
+            Clock::time_point t1 = Clock::now();
+
+            if(metric == FrameMetric::LATENCY){
+                total += std::chrono::duration_cast<DurationUnit>(t1 - t0).count();
+            } else {
+                total += allocation_count() - allocations;
+            }
+        }
+
+        graphs::new_result(type, std::to_string(size), total / FRAMES);
+    }
+}
+
+// memory footprint procedure
+//
+// Reports the bytes held through the counting allocators per element once
+// the create policy has filled the container.
+
+template<typename Container,
+         template<class> class CreatePolicy>
+void bench_footprint(const std::string& type, const std::initializer_list<int> &sizes){
+    for(auto size : sizes){
+        std::size_t bytes = allocated_bytes();
+        {
+            auto container = CreatePolicy<Container>::make(size);
+            bytes = allocated_bytes() - bytes;
+        }
+
+        graphs::new_result(type, std::to_string(size), bytes / size);
+    }
+
+    CreatePolicy<Container>::clean();
+}
+
+// page fault benchmarking procedure
+//
+// Same sampling as bench() but the minor and major page faults of each timed
+// region are counted next to its duration. With warm set, the create and test
+// policies first run once untimed before every sample so the allocator hands
+// the timed run recycled memory.
+
+enum class FaultMetric {
+    LATENCY,
+    MINOR_FAULTS,
+    MAJOR_FAULTS
+};
+
+struct page_faults {
+    std::size_t minor;
+    std::size_t major;
+};
+
+inline page_faults current_page_faults(){
+#if defined(_WIN32)
+    // Windows does not split soft and hard faults
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return { static_cast<std::size_t>(counters.PageFaultCount), 0 };
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return { static_cast<std::size_t>(usage.ru_minflt), static_cast<std::size_t>(usage.ru_majflt) };
+#endif
+}
+
+template<typename Container,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_faults(const std::string& type, const std::initializer_list<int> &sizes, FaultMetric metric, bool warm){
+    for(auto size : sizes){
+        std::size_t total = 0;
+        for(std::size_t attempts = 0; attempts < REPEAT; ++attempts){
+            if(warm){
+                auto container = CreatePolicy<Container>::make(size);
+                run<TestPolicy...>(container, size);
+            }
+
+            auto container = CreatePolicy<Container>::make(size);
+
+            page_faults before = current_page_faults();
+            Clock::time_point t0 = Clock::now();
+
+            run<TestPolicy...>(container, size);
+
+            Clock::time_point t1 = Clock::now();
+            page_faults after = current_page_faults();
+
+            if(metric == FaultMetric::LATENCY){
+                total += std::chrono::duration_cast<DurationUnit>(t1 - t0).count();
+            } else if(metric == FaultMetric::MINOR_FAULTS){
+                total += after.minor - before.minor;
+            } else {
+                total += after.major - before.major;
+            }
+        }
+
+        graphs::new_result(type, std::to_string(size), total / REPEAT);
+    }
+
+    CreatePolicy<Container>::clean();
+}
+
+// thread scaling benchmarking procedure
+//
+// A single container of the given size is benchmarked once per thread count,
+// the parallel test policies run on bench_pool() which holds that many threads.
+
+inline thread_pool*& bench_pool(){
+    static thread_pool* pool = nullptr;
+    return pool;
+}
+
+inline std::vector<std::size_t> thread_counts(){
+    std::size_t hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    std::vector<std::size_t> counts;
+    for(std::size_t threads = 1; threads < hardware; threads *= 2){
+        counts.push_back(threads);
+    }
+    counts.push_back(hardware);
+
+    return counts;
+}
+
+template<typename Container,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_threads(const std::string& type, std::size_t size, const std::vector<std::size_t> &threads){
+    auto container = CreatePolicy<Container>::make(size);
+
+    for(auto count : threads){
+        thread_pool pool(count);
+        bench_pool() = &pool;
+
+        std::size_t duration = 0;
+        for(std::size_t attempts = 0; attempts < REPEAT; ++attempts){
+            Clock::time_point t0 = Clock::now();
+
+            run<TestPolicy...>(container, size);
+
+            Clock::time_point t1 = Clock::now();
+            duration += std::chrono::duration_cast<DurationUnit>(t1 - t0).count();
+        }
+
+        graphs::new_result(type, std::to_string(count), duration / REPEAT);
+    }
+
+    bench_pool() = nullptr;
+
+    CreatePolicy<Container>::clean();
+}
+
+// Reference for bench_threads, for implementations that pick their own thread
+// count such as std::execution::par. It is measured once and reported at every
+// thread count, a flat line rather than a scaling curve.
+template<typename Container,
+         typename DurationUnit,
+         template<class> class CreatePolicy,
+         template<class> class ...TestPolicy>
+void bench_threads_reference(const std::string& type, std::size_t size, const std::vector<std::size_t> &threads){
+    auto container = CreatePolicy<Container>::make(size);
+
+    std::size_t duration = 0;
+    for(std::size_t attempts = 0; attempts < REPEAT; ++attempts){
+        Clock::time_point t0 = Clock::now();
+
+        run<TestPolicy...>(container, size);
+
+        Clock::time_point t1 = Clock::now();
+        duration += std::chrono::duration_cast<DurationUnit>(t1 - t0).count();
+    }
+
+    for(auto count : threads){
+        graphs::new_result(type, std::to_string(count), duration / REPEAT);
+    }
+
+    CreatePolicy<Container>::clean();
+}
+
+// concurrent benchmarking procedure
+//
+// For every thread count, each thread runs CONCURRENT_OPS operations of the
+// workload against one shared pool. Either the throughput of all the threads
+// or the 99th percentile latency of a single operation is reported.
+
+static const std::size_t CONCURRENT_OPS = 100000;
+
+enum class ConcurrentMetric {
+    THROUGHPUT,
+    P99
+};
+
+template<typename Pool,
+         template<class> class Workload>
+void bench_concurrent(const std::string& type, const std::vector<std::size_t> &threads, ConcurrentMetric metric){
+    for(auto count : threads){
+        Pool pool(count);
+        std::vector<std::vector<std::size_t>> latencies(count);
+        std::atomic<bool> start{false};
+
+        std::vector<std::thread> workers;
+        for(std::size_t thread = 0; thread < count; ++thread){
+            latencies[thread].reserve(CONCURRENT_OPS);
+            workers.emplace_back([&, thread]{
+                while(!start.load(std::memory_order_acquire)){
+                    std::this_thread::yield();
+                }
+                Workload<Pool>::run(pool, thread, CONCURRENT_OPS, latencies[thread]);
+            });
+        }
+
+        Clock::time_point t0 = Clock::now();
+        start.store(true, std::memory_order_release);
+        for(auto& worker : workers){
+            worker.join();
+        }
+        Clock::time_point t1 = Clock::now();
+
+        std::size_t value;
+        if(metric == ConcurrentMetric::THROUGHPUT){
+            // operations per millisecond
+            std::size_t duration = std::chrono::duration_cast<microseconds>(t1 - t0).count();
+            value = (count * CONCURRENT_OPS * 1000) / std::max<std::size_t>(duration, 1);
+        } else {
+            std::vector<std::size_t> all;
+            all.reserve(count * CONCURRENT_OPS);
+            for(auto& thread_latencies : latencies){
+                all.insert(all.end(), thread_latencies.begin(), thread_latencies.end());
+            }
+            auto p99 = all.begin() + (all.size() * 99) / 100;
+            std::nth_element(all.begin(), p99, all.end());
+            value = *p99;
+        }
+
+        graphs::new_result(type, std::to_string(count), value);
+    }
+}
+
 template<template<class> class Benchmark>
 void bench_types(){
     //Recursion end
@@ -117,7 +411,7 @@ std::string tag(std::string name){
 }
 
 template<typename T>
-void new_graph(const std::string &testName, const std::string &unit){
+void new_graph(const std::string &testName, const std::string &unit, const std::string &axis = "Number of elements"){
     std::string title(testName + " - " + demangle(typeid(T).name()));
-    graphs::new_graph(tag(title), title, unit);
+    graphs::new_graph(tag(title), title, unit, axis);
 }
@@ -0,0 +1,59 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Free function extensions to the Cluster containers, written against their
+// public interface so they can be benchmarked without modifying the submodule.
+
+#ifndef CLUSTERBENCH_CLUSTER_EXT
+#define CLUSTERBENCH_CLUSTER_EXT
+
+#include <cstddef>
+#include <iterator>
+
+#include <ClusterVector.h>
+#include <ClusterMap.h>
+
+#include "prefetch.hpp"
+
+namespace sw {
+
+// Copy the elements of a batch of handles to out, prefetching the elements
+// distance handles ahead
+template<typename T, typename Allocator, typename HandleIt, typename OutputIt>
+OutputIt at_batch(cluster_map<T, Allocator>& c, HandleIt first, HandleIt last, OutputIt out, std::size_t distance = 8){
+    gather(first, last, distance,
+        [&](const typename cluster_map<T, Allocator>::handle_type& handle){ return &c.at(handle); },
+        [&](const T& value){ *out++ = value; });
+    return out;
+}
+
+// Reverse traversal over the bidirectional cluster iterators, picked up by
+// argument dependent lookup next to std::rbegin and std::rend
+
+template<typename T, typename Allocator>
+std::reverse_iterator<typename cluster_vector<T, Allocator>::iterator> rbegin(cluster_vector<T, Allocator>& c){
+    return std::reverse_iterator<typename cluster_vector<T, Allocator>::iterator>(c.end());
+}
+
+template<typename T, typename Allocator>
+std::reverse_iterator<typename cluster_vector<T, Allocator>::iterator> rend(cluster_vector<T, Allocator>& c){
+    return std::reverse_iterator<typename cluster_vector<T, Allocator>::iterator>(c.begin());
+}
+
+template<typename T, typename Allocator>
+std::reverse_iterator<typename cluster_map<T, Allocator>::iterator> rbegin(cluster_map<T, Allocator>& c){
+    return std::reverse_iterator<typename cluster_map<T, Allocator>::iterator>(c.end());
+}
+
+template<typename T, typename Allocator>
+std::reverse_iterator<typename cluster_map<T, Allocator>::iterator> rend(cluster_map<T, Allocator>& c){
+    return std::reverse_iterator<typename cluster_map<T, Allocator>::iterator>(c.begin());
+}
+
+} //end of namespace sw
+
+#endif
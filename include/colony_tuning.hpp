@@ -0,0 +1,77 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_COLONY_TUNING
+#define CLUSTERBENCH_COLONY_TUNING
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "plf_colony.h"
+
+namespace sw {
+
+// colony with its skipfield type and group sizes fixed by the type, so that
+// a default constructed container already has the configuration
+template<typename T, typename Skipfield, std::size_t MinGroup, std::size_t MaxGroup, bool IntrusiveFreeList = false>
+class sized_colony : public plf::colony<T, std::allocator<T>, Skipfield, IntrusiveFreeList> {
+    static_assert(MinGroup > 2 && MinGroup <= MaxGroup, "sized_colony: invalid group sizes");
+    static_assert(MaxGroup <= std::numeric_limits<Skipfield>::max(), "sized_colony: the skipfield type cannot index MaxGroup elements");
+
+    public:
+        using skipfield_type = Skipfield;
+
+        static constexpr std::size_t min_group = MinGroup;
+        static constexpr std::size_t max_group = MaxGroup;
+
+        sized_colony(){
+            this->change_group_sizes(static_cast<Skipfield>(MinGroup), static_cast<Skipfield>(MaxGroup));
+        }
+};
+
+// Recommended colony parameters by element size, from the
+// colony_tuning_overall graph of bench_colony_tuning (measured with the
+// trivial 32, 64 and 128 bytes types, rerun it to refresh the table).
+// Small groups lose everywhere on churn: releasing a group scans the whole
+// erased locations stack and reinsertion searches the group of every reused
+// slot, both grow with the number of groups. Larger elements were not swept
+// and keep the stock limits.
+template<std::size_t ElementSize, typename Enable = void>
+struct colony_tuning {
+    using skipfield_type = std::uint16_t;
+    static constexpr std::size_t min_group = 8;
+    static constexpr std::size_t max_group = 65535;
+};
+
+// Up to 64 bytes, very large groups are best for fill and churn
+template<std::size_t ElementSize>
+struct colony_tuning<ElementSize, typename std::enable_if<(ElementSize <= 64)>::type> {
+    using skipfield_type = std::uint32_t;
+    static constexpr std::size_t min_group = 8;
+    static constexpr std::size_t max_group = 1048576;
+};
+
+// Up to 128 bytes, fixed groups of 65536 elements
+template<std::size_t ElementSize>
+struct colony_tuning<ElementSize, typename std::enable_if<(ElementSize > 64 && ElementSize <= 128)>::type> {
+    using skipfield_type = std::uint32_t;
+    static constexpr std::size_t min_group = 65536;
+    static constexpr std::size_t max_group = 65536;
+};
+
+template<typename T>
+using tuned_colony = sized_colony<T,
+    typename colony_tuning<sizeof(T)>::skipfield_type,
+    colony_tuning<sizeof(T)>::min_group,
+    colony_tuning<sizeof(T)>::max_group>;
+
+} //end of namespace sw
+
+#endif
@@ -0,0 +1,170 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_CONCURRENT_CLUSTER_MAP
+#define CLUSTERBENCH_CONCURRENT_CLUSTER_MAP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace sw {
+
+// Handle based pool safe for concurrent insert, erase and access from any
+// number of threads, as long as a handle is not erased while it is accessed.
+//
+// Elements live in fixed size chunks which are never moved or freed before
+// destruction. A free slot is reserved lock free, either by popping the
+// shared stack of erased slots or by bumping the fill index of the current
+// chunk; the mutex is only taken to append a new chunk.
+template<typename T, std::size_t ChunkSize = 1024>
+class concurrent_cluster_map {
+    static_assert(ChunkSize > 0, "Invalid chunk size");
+
+    public:
+        using value_type = T;
+        using handle_type = std::uint32_t;
+
+        explicit concurrent_cluster_map(std::size_t maxChunks = 1u << 16)
+            : directory(new std::atomic<chunk*>[maxChunks])
+            , max_chunks(maxChunks)
+        {
+            if(static_cast<std::uint64_t>(maxChunks) * ChunkSize >= empty_slot){
+                throw std::length_error("concurrent_cluster_map: too many slots for handle_type");
+            }
+
+            for(std::size_t i = 0; i < max_chunks; ++i){
+                directory[i].store(nullptr, std::memory_order_relaxed);
+            }
+            directory[0].store(new chunk(), std::memory_order_release);
+        }
+
+        ~concurrent_cluster_map(){
+            std::size_t chunks = current.load(std::memory_order_relaxed) + 1;
+            for(std::size_t c = 0; c < chunks; ++c){
+                chunk* ch = directory[c].load(std::memory_order_relaxed);
+                std::size_t reserved = std::min<std::size_t>(ch->reserved.load(std::memory_order_relaxed), ChunkSize);
+                for(std::size_t slot = 0; slot < reserved; ++slot){
+                    if(ch->live[slot].load(std::memory_order_relaxed)){
+                        ch->element(slot)->~T();
+                    }
+                }
+                delete ch;
+            }
+        }
+
+        concurrent_cluster_map(const concurrent_cluster_map&) = delete;
+        concurrent_cluster_map& operator=(const concurrent_cluster_map&) = delete;
+
+        template<typename... Args>
+        handle_type emplace(Args&&... args){
+            handle_type handle = reserve();
+            chunk* ch = chunk_of(handle);
+            new (ch->element(handle % ChunkSize)) T(std::forward<Args>(args)...);
+            ch->live[handle % ChunkSize].store(1, std::memory_order_release);
+            return handle;
+        }
+
+        handle_type insert(const T& value){ return emplace(value); }
+        handle_type insert(T&& value){ return emplace(std::move(value)); }
+
+        void erase(handle_type handle){
+            chunk* ch = chunk_of(handle);
+            ch->element(handle % ChunkSize)->~T();
+            ch->live[handle % ChunkSize].store(0, std::memory_order_relaxed);
+
+            // push the slot on the free stack, the tag in the upper half of
+            // the head protects the pops against ABA
+            std::uint64_t head = free_head.load(std::memory_order_relaxed);
+            do {
+                ch->next_free[handle % ChunkSize].store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+            } while(!free_head.compare_exchange_weak(head, next_tag(head) | handle, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        T& at(handle_type handle){ return *chunk_of(handle)->element(handle % ChunkSize); }
+        const T& at(handle_type handle) const { return *chunk_of(handle)->element(handle % ChunkSize); }
+
+        std::size_t chunk_count() const { return current.load(std::memory_order_acquire) + 1; }
+
+    private:
+        static const std::uint32_t empty_slot = 0xFFFFFFFFu;
+
+        struct chunk {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[ChunkSize];
+            std::atomic<std::uint32_t> next_free[ChunkSize];
+            std::atomic<std::uint8_t> live[ChunkSize];
+            std::atomic<std::size_t> reserved{0};
+
+            chunk(){
+                for(std::size_t i = 0; i < ChunkSize; ++i){
+                    live[i].store(0, std::memory_order_relaxed);
+                }
+            }
+
+            T* element(std::size_t slot){ return reinterpret_cast<T*>(&storage[slot]); }
+        };
+
+        static std::uint64_t next_tag(std::uint64_t head){
+            return ((head >> 32) + 1) << 32;
+        }
+
+        chunk* chunk_of(handle_type handle) const {
+            return directory[handle / ChunkSize].load(std::memory_order_acquire);
+        }
+
+        handle_type reserve(){
+            std::uint64_t head = free_head.load(std::memory_order_acquire);
+            while(static_cast<std::uint32_t>(head) != empty_slot){
+                handle_type slot = static_cast<std::uint32_t>(head);
+                std::uint32_t next = chunk_of(slot)->next_free[slot % ChunkSize].load(std::memory_order_relaxed);
+                if(free_head.compare_exchange_weak(head, next_tag(head) | next, std::memory_order_acquire, std::memory_order_acquire)){
+                    return slot;
+                }
+            }
+
+            while(true){
+                std::size_t c = current.load(std::memory_order_acquire);
+                std::size_t slot = directory[c].load(std::memory_order_acquire)->reserved.fetch_add(1, std::memory_order_relaxed);
+                if(slot < ChunkSize){
+                    return static_cast<handle_type>(c * ChunkSize + slot);
+                }
+
+                grow(c);
+            }
+        }
+
+        void grow(std::size_t full){
+            std::lock_guard<std::mutex> lock(growth);
+            if(current.load(std::memory_order_relaxed) != full){
+                return;
+            }
+
+            if(full + 1 == max_chunks){
+                throw std::length_error("concurrent_cluster_map: out of chunks");
+            }
+
+            directory[full + 1].store(new chunk(), std::memory_order_release);
+            current.store(full + 1, std::memory_order_release);
+        }
+
+        std::unique_ptr<std::atomic<chunk*>[]> directory;
+        std::size_t max_chunks;
+        std::atomic<std::size_t> current{0};
+        std::atomic<std::uint64_t> free_head{empty_slot};
+        std::mutex growth;
+};
+
+} //end of namespace sw
+
+#endif
@@ -0,0 +1,55 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_COUNTING_ALLOCATOR
+#define CLUSTERBENCH_COUNTING_ALLOCATOR
+
+#include <cstddef>
+#include <memory>
+
+// Number of allocations made through the counting allocators since startup
+inline std::size_t& allocation_count(){
+    static std::size_t count = 0;
+    return count;
+}
+
+// Bytes currently held through the counting allocators
+inline std::size_t& allocated_bytes(){
+    static std::size_t bytes = 0;
+    return bytes;
+}
+
+// Forwards to std::allocator and counts every call to allocate and the bytes
+// in use
+template<typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(std::size_t n){
+        ++allocation_count();
+        allocated_bytes() += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n){
+        allocated_bytes() -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const counting_allocator<T>&, const counting_allocator<U>&){ return true; }
+
+template<typename T, typename U>
+bool operator!=(const counting_allocator<T>&, const counting_allocator<U>&){ return false; }
+
+#endif
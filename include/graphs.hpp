@@ -24,9 +24,10 @@ struct graph {
     std::string name;
     std::string title;
     std::string unit;
+    std::string axis;
     std::vector<result> results;
 
-    graph(const std::string& name, const std::string& title, const std::string& unit) : name(name), title(title), unit(unit) {}
+    graph(const std::string& name, const std::string& title, const std::string& unit, const std::string& axis) : name(name), title(title), unit(unit), axis(axis) {}
 };
 
 enum class Output : unsigned int {
@@ -34,8 +35,9 @@ enum class Output : unsigned int {
     PLUGIN
 };
 
-void new_graph(const std::string& graph_name, const std::string& graph_title, const std::string& unit);
+void new_graph(const std::string& graph_name, const std::string& graph_title, const std::string& unit, const std::string& axis = "Number of elements");
 void new_result(const std::string& serie, const std::string& group, std::size_t value);
+const std::vector<result>& current_results();
 void output(Output output);
 
 }
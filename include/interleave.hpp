@@ -0,0 +1,89 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_INTERLEAVE
+#define CLUSTERBENCH_INTERLEAVE
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#include "prefetch.hpp"
+
+// Coroutine owning its frame, resumed by hand until it is done
+class lookup_task {
+    public:
+        struct promise_type {
+            lookup_task get_return_object(){ return lookup_task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void(){}
+            void unhandled_exception(){ std::terminate(); }
+        };
+
+        lookup_task(lookup_task&& rhs) noexcept : handle(std::exchange(rhs.handle, nullptr)) {}
+        lookup_task(const lookup_task&) = delete;
+        lookup_task& operator=(const lookup_task&) = delete;
+
+        ~lookup_task(){
+            if(handle){
+                handle.destroy();
+            }
+        }
+
+        bool done() const { return handle.done(); }
+        void resume(){ handle.resume(); }
+
+    private:
+        explicit lookup_task(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+        std::coroutine_handle<promise_type> handle;
+};
+
+namespace detail {
+
+// Take the next handle of the shared cursor, prefetch its element and let the
+// other lookups of the group run until the line has arrived
+template<typename HandleIt, typename Resolve, typename Function>
+lookup_task lookup_stream(HandleIt& next, HandleIt last, Resolve& resolve, Function& f){
+    while(next != last){
+        auto element = resolve(*next++);
+        prefetch(element);
+        co_await std::suspend_always{};
+        f(*element);
+    }
+}
+
+} //end of namespace detail
+
+// Call f(*resolve(h)) for every handle h of [first, last), with group lookups
+// in flight at once (AMAC / CoroBase style). Each lookup suspends after its
+// prefetch and the group is resumed round robin, so the misses of independent
+// lookups overlap without changing the container layout.
+template<typename HandleIt, typename Resolve, typename Function>
+void interleave(HandleIt first, HandleIt last, std::size_t group, Resolve resolve, Function f){
+    std::vector<lookup_task> lookups;
+    lookups.reserve(group);
+    for(std::size_t i = 0; i < group; ++i){
+        lookups.push_back(detail::lookup_stream(first, last, resolve, f));
+    }
+
+    std::size_t running = group;
+    while(running > 0){
+        running = 0;
+        for(auto& lookup : lookups){
+            if(!lookup.done()){
+                lookup.resume();
+                running += !lookup.done();
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,456 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// File backed clusters. The header and the chunks live in a file mapped in
+// full, and nothing stored in it is a pointer: handles and free list links
+// are byte offsets from the start of the file. Reopening a file therefore
+// gives back a usable container, with the handles of the previous process
+// still valid, without reading or converting a single element. Elements
+// must be trivially copyable since they are never constructed again.
+
+#ifndef CLUSTERBENCH_MAPPED_CLUSTER
+#define CLUSTERBENCH_MAPPED_CLUSTER
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sw {
+
+namespace detail {
+
+// A file mapped read write in full. Growing the file remaps it, possibly at
+// another address, which is why the file only holds offsets.
+class mapped_file {
+    public:
+        mapped_file() = default;
+
+        mapped_file(const std::string& path, bool truncate){
+#if defined(_WIN32)
+            file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                truncate ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if(file == INVALID_HANDLE_VALUE){
+                throw std::runtime_error("mapped_file: cannot open " + path);
+            }
+
+            LARGE_INTEGER size;
+            GetFileSizeEx(file, &size);
+            bytes = static_cast<std::uint64_t>(size.QuadPart);
+#else
+            fd = ::open(path.c_str(), truncate ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0644);
+            if(fd < 0){
+                throw std::runtime_error("mapped_file: cannot open " + path);
+            }
+
+            struct stat status;
+            fstat(fd, &status);
+            bytes = static_cast<std::uint64_t>(status.st_size);
+#endif
+            if(bytes > 0){
+                map();
+            }
+        }
+
+        ~mapped_file(){
+            close();
+        }
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        mapped_file(mapped_file&& rhs) noexcept {
+            swap(rhs);
+        }
+
+        mapped_file& operator=(mapped_file&& rhs) noexcept {
+            mapped_file(std::move(rhs)).swap(*this);
+            return *this;
+        }
+
+        // Grow or shrink the file to the given size and map it again
+        void resize(std::uint64_t size){
+            unmap();
+#if !defined(_WIN32)
+            if(ftruncate(fd, static_cast<off_t>(size)) != 0){
+                throw std::bad_alloc();
+            }
+#endif
+            // on Windows creating a larger mapping extends the file
+            bytes = size;
+            map();
+        }
+
+        // Write the dirty pages back to the file
+        void flush(){
+#if defined(_WIN32)
+            FlushViewOfFile(base, 0);
+            FlushFileBuffers(file);
+#else
+            msync(base, bytes, MS_SYNC);
+#endif
+        }
+
+        std::byte* data() const { return base; }
+        std::uint64_t size() const { return bytes; }
+        bool is_open() const { return base != nullptr; }
+
+    private:
+        void map(){
+#if defined(_WIN32)
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(bytes >> 32), static_cast<DWORD>(bytes), nullptr);
+            void* p = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0) : nullptr;
+#else
+            void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if(p == MAP_FAILED){
+                p = nullptr;
+            }
+#endif
+            if(p == nullptr){
+                throw std::bad_alloc();
+            }
+            base = static_cast<std::byte*>(p);
+        }
+
+        void unmap(){
+            if(base != nullptr){
+#if defined(_WIN32)
+                UnmapViewOfFile(base);
+                CloseHandle(mapping);
+                mapping = nullptr;
+#else
+                munmap(base, bytes);
+#endif
+                base = nullptr;
+            }
+        }
+
+        void close(){
+            unmap();
+#if defined(_WIN32)
+            if(file != INVALID_HANDLE_VALUE){
+                CloseHandle(file);
+                file = INVALID_HANDLE_VALUE;
+            }
+#else
+            if(fd >= 0){
+                ::close(fd);
+                fd = -1;
+            }
+#endif
+        }
+
+        void swap(mapped_file& rhs) noexcept {
+            std::swap(base, rhs.base);
+            std::swap(bytes, rhs.bytes);
+#if defined(_WIN32)
+            std::swap(file, rhs.file);
+            std::swap(mapping, rhs.mapping);
+#else
+            std::swap(fd, rhs.fd);
+#endif
+        }
+
+        std::byte* base = nullptr;
+        std::uint64_t bytes = 0;
+#if defined(_WIN32)
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#else
+        int fd = -1;
+#endif
+};
+
+// Chunked slots in a mapped file. The file starts with a header, then the
+// chunks follow back to back, each one an optional array of slot links then
+// its slots. A handle is the file offset of a slot.
+template<typename T, std::size_t ChunkSize, bool Links>
+class mapped_chunks {
+    static_assert(std::is_trivially_copyable<T>::value, "mapped clusters only store trivially copyable types");
+    static_assert(alignof(T) <= 4096, "mapped clusters cannot align past a page");
+    static_assert(ChunkSize > 0, "Invalid chunk size");
+
+    public:
+        using value_type = T;
+        using handle_type = std::uint64_t;
+
+        class iterator {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+                iterator() = default;
+
+                T& operator*() const { return *owner->slot(chunk, slot); }
+                T* operator->() const { return owner->slot(chunk, slot); }
+
+                iterator& operator++(){
+                    advance();
+                    skip_erased();
+                    return *this;
+                }
+
+                iterator operator++(int){
+                    iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                bool operator==(const iterator& rhs) const { return chunk == rhs.chunk && slot == rhs.slot; }
+                bool operator!=(const iterator& rhs) const { return !(*this == rhs); }
+
+            private:
+                friend class mapped_chunks;
+
+                iterator(const mapped_chunks* o, std::uint64_t position)
+                    : owner(o), chunk(position / ChunkSize), slot(position % ChunkSize) {}
+
+                void advance(){
+                    if(++slot == ChunkSize){
+                        ++chunk;
+                        slot = 0;
+                    }
+                }
+
+                void skip_erased(){
+                    if constexpr(Links){
+                        std::uint64_t filled = owner->head()->filled;
+                        while(chunk * ChunkSize + slot < filled && owner->link(chunk, slot) != live_link){
+                            advance();
+                        }
+                    }
+                }
+
+                const mapped_chunks* owner = nullptr;
+                std::uint64_t chunk = 0;
+                std::uint64_t slot = 0;
+        };
+
+        mapped_chunks() = default;
+
+        iterator begin() const {
+            iterator it(this, 0);
+            if(file.is_open()){
+                it.skip_erased();
+            }
+            return it;
+        }
+
+        iterator end() const {
+            return iterator(this, file.is_open() ? head()->filled : 0);
+        }
+
+        T& at(handle_type handle){
+            return *reinterpret_cast<T*>(file.data() + handle);
+        }
+
+        const T& at(handle_type handle) const {
+            return *reinterpret_cast<const T*>(file.data() + handle);
+        }
+
+        // Forget every element, the file keeps its size
+        void clear(){
+            head()->filled = 0;
+            head()->count = 0;
+            head()->free_head = 0;
+        }
+
+        void flush(){ file.flush(); }
+
+        std::size_t size() const { return file.is_open() ? static_cast<std::size_t>(head()->count) : 0; }
+        bool empty() const { return size() == 0; }
+
+    protected:
+        static constexpr std::uint64_t magic = 0x52455453554c4357ull;
+        static constexpr std::uint64_t live_link = ~0ull;
+
+        struct header {
+            std::uint64_t magic;
+            std::uint64_t links;
+            std::uint64_t value_size;
+            std::uint64_t value_align;
+            std::uint64_t chunk_size;
+            std::uint64_t filled;
+            std::uint64_t count;
+            std::uint64_t free_head;
+        };
+
+        static constexpr std::uint64_t round_up(std::uint64_t n, std::uint64_t alignment){
+            return (n + alignment - 1) / alignment * alignment;
+        }
+
+        static constexpr std::uint64_t chunk_align = alignof(T) > alignof(std::uint64_t) ? alignof(T) : alignof(std::uint64_t);
+        static constexpr std::uint64_t header_bytes = round_up(sizeof(header), chunk_align > 64 ? chunk_align : 64);
+        static constexpr std::uint64_t links_bytes = Links ? round_up(ChunkSize * sizeof(std::uint64_t), alignof(T)) : 0;
+        static constexpr std::uint64_t chunk_bytes = round_up(links_bytes + ChunkSize * sizeof(T), chunk_align);
+
+        mapped_chunks(const std::string& path, bool truncate) : file(path, truncate) {
+            if(truncate){
+                file.resize(header_bytes + chunk_bytes);
+                new (file.data()) header{ magic, Links, sizeof(T), alignof(T), ChunkSize, 0, 0, 0 };
+                return;
+            }
+
+            const header* h = file.size() >= header_bytes ? head() : nullptr;
+            if(h == nullptr || h->magic != magic || h->links != Links || h->value_size != sizeof(T)
+                    || h->value_align != alignof(T) || h->chunk_size != ChunkSize){
+                throw std::runtime_error("mapped_chunks: " + path + " was not written for this container");
+            }
+        }
+
+        header* head() const {
+            return reinterpret_cast<header*>(file.data());
+        }
+
+        std::byte* chunk_base(std::uint64_t chunk) const {
+            return file.data() + header_bytes + chunk * chunk_bytes;
+        }
+
+        T* slot(std::uint64_t chunk, std::uint64_t index) const {
+            return reinterpret_cast<T*>(chunk_base(chunk) + links_bytes) + index;
+        }
+
+        std::uint64_t& link(std::uint64_t chunk, std::uint64_t index) const {
+            return reinterpret_cast<std::uint64_t*>(chunk_base(chunk))[index];
+        }
+
+        std::uint64_t& link(handle_type handle) const {
+            std::uint64_t chunk = (handle - header_bytes) / chunk_bytes;
+            std::uint64_t index = (handle - header_bytes - chunk * chunk_bytes - links_bytes) / sizeof(T);
+            return link(chunk, index);
+        }
+
+        handle_type offset(std::uint64_t chunk, std::uint64_t index) const {
+            return header_bytes + chunk * chunk_bytes + links_bytes + index * sizeof(T);
+        }
+
+        // Store a value in the next never used slot, doubling the file when
+        // its chunks are all filled
+        handle_type append(const T& value){
+            std::uint64_t filled = head()->filled;
+            std::uint64_t capacity = (file.size() - header_bytes) / chunk_bytes * ChunkSize;
+            if(filled == capacity){
+                std::uint64_t chunks = capacity / ChunkSize;
+                file.resize(header_bytes + 2 * chunks * chunk_bytes);
+            }
+
+            std::uint64_t chunk = filled / ChunkSize;
+            std::uint64_t index = filled % ChunkSize;
+            new (slot(chunk, index)) T(value);
+            if constexpr(Links){
+                link(chunk, index) = live_link;
+            }
+
+            head()->filled = filled + 1;
+            ++head()->count;
+
+            return offset(chunk, index);
+        }
+
+        detail::mapped_file file;
+};
+
+} //end of namespace detail
+
+// File backed counterpart of cluster_vector: elements are appended and
+// never erased, so iteration walks the chunks without any check
+template<typename T, std::size_t ChunkSize = 1024>
+class mapped_cluster_vector : public detail::mapped_chunks<T, ChunkSize, false> {
+    using base_type = detail::mapped_chunks<T, ChunkSize, false>;
+
+    public:
+        using typename base_type::handle_type;
+
+        mapped_cluster_vector() = default;
+
+        // Start a new file, replacing any existing one
+        static mapped_cluster_vector create(const std::string& path){
+            return mapped_cluster_vector(path, true);
+        }
+
+        // Map a file written by a previous mapped_cluster_vector of the same type
+        static mapped_cluster_vector open(const std::string& path){
+            return mapped_cluster_vector(path, false);
+        }
+
+        handle_type push_back(const T& value){
+            return this->append(value);
+        }
+
+    private:
+        mapped_cluster_vector(const std::string& path, bool truncate) : base_type(path, truncate) {}
+};
+
+// File backed counterpart of cluster_map: every slot has a link which marks
+// it live or, once erased, holds the offset of the next free slot, so erased
+// slots are reused and the free list survives a reopen
+template<typename T, std::size_t ChunkSize = 1024>
+class mapped_cluster_map : public detail::mapped_chunks<T, ChunkSize, true> {
+    using base_type = detail::mapped_chunks<T, ChunkSize, true>;
+
+    public:
+        using typename base_type::handle_type;
+
+        mapped_cluster_map() = default;
+
+        // Start a new file, replacing any existing one
+        static mapped_cluster_map create(const std::string& path){
+            return mapped_cluster_map(path, true);
+        }
+
+        // Map a file written by a previous mapped_cluster_map of the same type
+        static mapped_cluster_map open(const std::string& path){
+            return mapped_cluster_map(path, false);
+        }
+
+        handle_type insert(const T& value){
+            handle_type handle = this->head()->free_head;
+            if(handle == 0){
+                return this->append(value);
+            }
+
+            std::uint64_t& link = this->link(handle);
+            this->head()->free_head = link;
+            link = base_type::live_link;
+            new (&this->at(handle)) T(value);
+            ++this->head()->count;
+
+            return handle;
+        }
+
+        void erase(handle_type handle){
+            this->link(handle) = this->head()->free_head;
+            this->head()->free_head = handle;
+            --this->head()->count;
+        }
+
+    private:
+        mapped_cluster_map(const std::string& path, bool truncate) : base_type(path, truncate) {}
+};
+
+} //end of namespace sw
+
+#endif
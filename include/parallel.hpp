@@ -0,0 +1,175 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_PARALLEL
+#define CLUSTERBENCH_PARALLEL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "plf_colony.h"
+
+// Fork-join pool, the calling thread takes part in every parallel_for so a
+// pool of size 1 runs the tasks inline.
+class thread_pool {
+    public:
+        explicit thread_pool(std::size_t threads){
+            for(std::size_t i = 1; i < threads; ++i){
+                workers.emplace_back([this]{ work(); });
+            }
+        }
+
+        ~thread_pool(){
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            wake.notify_all();
+
+            for(auto& worker : workers){
+                worker.join();
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        std::size_t size() const { return workers.size() + 1; }
+
+        // Run task(i) for every i in [0, count) and wait for all of them
+        void parallel_for(std::size_t count, std::function<void(std::size_t)> task){
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                current = std::move(task);
+                task_count = count;
+                next_task = 0;
+                pending = workers.size();
+                ++generation;
+            }
+            wake.notify_all();
+
+            execute();
+
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [this]{ return pending == 0; });
+        }
+
+    private:
+        void execute(){
+            for(std::size_t i = next_task++; i < task_count; i = next_task++){
+                current(i);
+            }
+        }
+
+        void work(){
+            std::size_t seen = 0;
+
+            while(true){
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&]{ return stop || generation != seen; });
+                    if(stop){
+                        return;
+                    }
+                    seen = generation;
+                }
+
+                execute();
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if(--pending == 0){
+                    finished.notify_one();
+                }
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable finished;
+
+        std::function<void(std::size_t)> current;
+        std::size_t task_count = 0;
+        std::atomic<std::size_t> next_task{0};
+        std::size_t pending = 0;
+        std::size_t generation = 0;
+        bool stop = false;
+};
+
+// Split a container into at most parts iterator ranges of near equal element
+// count. Generic containers are walked once, colony is split on its groups
+// without walking any element.
+
+template<typename Container>
+std::vector<std::pair<typename Container::iterator, typename Container::iterator>> partition(Container& c, std::size_t parts){
+    std::vector<std::pair<typename Container::iterator, typename Container::iterator>> ranges;
+
+    std::size_t size = static_cast<std::size_t>(std::distance(c.begin(), c.end()));
+    auto first = c.begin();
+    for(std::size_t i = 0; i < parts && first != c.end(); ++i){
+        auto last = std::next(first, (size * (i + 1)) / parts - (size * i) / parts);
+        ranges.emplace_back(first, last);
+        first = last;
+    }
+
+    return ranges;
+}
+
+template<typename T, typename Allocator, typename Skipfield, bool Intrusive>
+std::vector<std::pair<typename plf::colony<T, Allocator, Skipfield, Intrusive>::iterator, typename plf::colony<T, Allocator, Skipfield, Intrusive>::iterator>> partition(plf::colony<T, Allocator, Skipfield, Intrusive>& c, std::size_t parts){
+    std::vector<std::pair<typename plf::colony<T, Allocator, Skipfield, Intrusive>::iterator, typename plf::colony<T, Allocator, Skipfield, Intrusive>::iterator>> ranges;
+    ranges.reserve(parts);
+    c.partition(parts, std::back_inserter(ranges));
+    return ranges;
+}
+
+// Parts a container is split into ahead of time, a few ranges per hardware
+// thread so that every pool size can still balance its workers
+inline std::size_t partition_parts(){
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency()) * 4;
+}
+
+// Call f(first, last) on ranges made beforehand by partition(), the ranges
+// are handed out to the workers of the pool as they become free
+template<typename Iterator, typename Function>
+void parallel_for_partition(const std::vector<std::pair<Iterator, Iterator>>& ranges, thread_pool& pool, Function f){
+    pool.parallel_for(ranges.size(), [&](std::size_t i){
+        f(ranges[i].first, ranges[i].second);
+    });
+}
+
+template<typename Iterator, typename Function>
+void parallel_for_each_partition(const std::vector<std::pair<Iterator, Iterator>>& ranges, thread_pool& pool, Function f){
+    parallel_for_partition(ranges, pool, [&](Iterator first, Iterator last){
+        for(; first != last; ++first){
+            f(*first);
+        }
+    });
+}
+
+// Same on near equal ranges of the container, split on every call
+template<typename Container, typename Function>
+void parallel_for_ranges(Container& c, thread_pool& pool, Function f){
+    const std::size_t ranges_per_thread = 4;
+    parallel_for_partition(partition(c, pool.size() * ranges_per_thread), pool, f);
+}
+
+template<typename Container, typename Function>
+void parallel_for_each(Container& c, thread_pool& pool, Function f){
+    const std::size_t ranges_per_thread = 4;
+    parallel_for_each_partition(partition(c, pool.size() * ranges_per_thread), pool, f);
+}
+
+#endif
@@ -24,6 +24,7 @@ struct ClusterContainerBenchType
 
     ClusterContainer container;
     std::vector<HandleType> handles; 
+    std::size_t prefetch_distance = 0;
 };
 
 template<typename RegularContainer, typename HandleType>
@@ -41,6 +42,88 @@ struct ContainerBenchType
 
     RegularContainer container;
     std::vector<HandleType> handles; 
+    std::size_t prefetch_distance = 0;
+};
+
+// Container split with partition() along with its creation, so that the
+// parallel policies only hand out ready made ranges. The container is held
+// through a pointer so that the ranges survive the moves of the bench type.
+template<typename ContainerType>
+struct PartitionedBenchType
+{
+    using Container = ContainerType;
+    using Range = std::pair<typename Container::iterator, typename Container::iterator>;
+
+    std::unique_ptr<Container> container;
+    std::vector<Range> ranges;
+};
+
+// Shared pools for the concurrent benchmarks, every call names the thread
+// making it
+
+template<typename ContainerType>
+struct LockedPool
+{
+    using Container = ContainerType;
+    using handle_type = typename Container::handle_type;
+    using value_type = typename Container::value_type;
+
+    LockedPool(std::size_t) {}
+
+    handle_type insert(std::size_t, const value_type& value){
+        std::lock_guard<std::mutex> lock(mutex);
+        return container.insert(value);
+    }
+
+    void erase(std::size_t, handle_type handle){
+        std::lock_guard<std::mutex> lock(mutex);
+        container.erase(handle);
+    }
+
+    std::size_t read(std::size_t, handle_type handle){
+        std::lock_guard<std::mutex> lock(mutex);
+        return container.at(handle).a;
+    }
+
+    std::mutex mutex;
+    Container container;
+};
+
+template<typename ContainerType>
+struct ShardedPool
+{
+    using Container = ContainerType;
+    using handle_type = typename Container::handle_type;
+    using value_type = typename Container::value_type;
+
+    // shards are allocated separately so they do not share cache lines
+    ShardedPool(std::size_t threads){
+        for(std::size_t i = 0; i < threads; ++i){
+            shards.emplace_back(new Container());
+        }
+    }
+
+    handle_type insert(std::size_t thread, const value_type& value){ return shards[thread]->insert(value); }
+    void erase(std::size_t thread, handle_type handle){ shards[thread]->erase(handle); }
+    std::size_t read(std::size_t thread, handle_type handle){ return shards[thread]->at(handle).a; }
+
+    std::vector<std::unique_ptr<Container>> shards;
+};
+
+template<typename ContainerType>
+struct ConcurrentPool
+{
+    using Container = ContainerType;
+    using handle_type = typename Container::handle_type;
+    using value_type = typename Container::value_type;
+
+    ConcurrentPool(std::size_t) {}
+
+    handle_type insert(std::size_t, const value_type& value){ return container.insert(value); }
+    void erase(std::size_t, handle_type handle){ container.erase(handle); }
+    std::size_t read(std::size_t, handle_type handle){ return container.at(handle).a; }
+
+    Container container;
 };
 
 //Create empty container
@@ -138,8 +221,7 @@ struct FilledRandomColony {
         Container pack(size);
         pack.handles.reserve(size);
         for(std::size_t i = 0; i < size; ++i){
-            pack.container.insert(typename Container::Container::value_type{});
-            pack.handles.push_back(pack.container.end()--);
+            pack.handles.push_back(pack.container.insert(typename Container::Container::value_type{}));
         }
         std::shuffle(begin(pack.handles), end(pack.handles), std::mt19937());
 
@@ -220,6 +302,27 @@ struct FilledRandomInsert {
 template<class Container>
 std::vector<typename Container::value_type> FilledRandomInsert<Container>::v;
 
+// FilledRandomInsert then every element whose key is a multiple of 4 erased,
+// the keys are shuffled so the holes are spread at random
+template<class Container>
+struct FilledRandomHoles {
+    inline static Container make(std::size_t size){
+        Container container = FilledRandomInsert<Container>::make(size);
+        for(auto it = container.begin(); it != container.end();){
+            if(it->a % 4 == 0){
+                it = container.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return container;
+    }
+
+    inline static void clean(){
+        FilledRandomInsert<Container>::clean();
+    }
+};
+
 template<class Container>
 struct SmartFilled {
     inline static std::unique_ptr<Container> make(std::size_t size){
@@ -259,8 +362,215 @@ struct BackupSmartFilled {
 template<class Container>
 std::vector<typename Container::value_type> BackupSmartFilled<Container>::v;
 
+template<class Container>
+struct BackupSmartFilledInsert {
+    static std::vector<typename Container::value_type> v;
+    inline static std::unique_ptr<Container> make(std::size_t size){
+        if(v.size() != size){
+            v.clear();
+            v.reserve(size);
+            for(std::size_t i = 0; i < size; ++i){
+                v.push_back({i});
+            }
+        }
+
+        std::unique_ptr<Container> container(new Container());
+
+        for(std::size_t i = 0; i < size; ++i){
+            container->insert(v[i]);
+        }
+
+        return container;
+    }
+
+    inline static void clean(){
+        v.clear();
+        v.shrink_to_fit();
+    }
+};
+
+template<class Container>
+std::vector<typename Container::value_type> BackupSmartFilledInsert<Container>::v;
+
+// Partitioned creates the container with CreatePolicy then splits it into
+// partition_parts() ranges, outside of the timed region
+
+template<template<class> class CreatePolicy>
+struct Partitioned {
+    template<class Bench>
+    struct Create {
+        inline static Bench make(std::size_t size){
+            using Container = typename Bench::Container;
+
+            Bench b;
+            b.container.reset(new Container(CreatePolicy<Container>::make(size)));
+            b.ranges = partition(*b.container, partition_parts());
+            return b;
+        }
+
+        inline static void clean(){
+            CreatePolicy<typename Bench::Container>::clean();
+        }
+    };
+};
+
+// After runs TestPolicy once on the created container, so that bench_footprint
+// measures the container in the state the test leaves it in
+
+template<template<class> class CreatePolicy, template<class> class TestPolicy>
+struct After {
+    template<class Container>
+    struct Create {
+        inline static Container make(std::size_t size){
+            auto c = CreatePolicy<Container>::make(size);
+            TestPolicy<Container>::run(c, size);
+            return c;
+        }
+
+        inline static void clean(){
+            CreatePolicy<Container>::clean();
+        }
+    };
+};
+
+// startup policies
+//
+// Rebuilt times a whole creation: its create step only runs CreatePolicy
+// once per size, so that the source data is prepared, and its Build step
+// creates the container in the timed region. Mapped writes a file once per
+// size with the Fill policy, and its Reopen step maps the file back.
+
+template<template<class> class CreatePolicy>
+struct Rebuilt {
+    template<class Container>
+    struct Create {
+        static std::size_t& prepared(){
+            static std::size_t size = 0;
+            return size;
+        }
+
+        inline static Container make(std::size_t size){
+            if(prepared() != size){
+                CreatePolicy<Container>::make(size);
+                prepared() = size;
+            }
+            return Container();
+        }
+
+        inline static void clean(){
+            CreatePolicy<Container>::clean();
+            prepared() = 0;
+        }
+    };
+
+    template<class Container>
+    struct Build {
+        inline static void run(Container &c, std::size_t size){
+            c = CreatePolicy<Container>::make(size);
+        }
+    };
+};
+
+template<template<class> class Fill>
+struct Mapped {
+    template<class Container>
+    struct Create {
+        static std::size_t& built(){
+            static std::size_t size = 0;
+            return size;
+        }
+
+        static std::string path(){
+            return "mapped_" + std::to_string(typeid(Container).hash_code()) + ".bin";
+        }
+
+        inline static Container make(std::size_t size){
+            if(built() != size){
+                Container container = Container::create(path());
+                Fill<Container>::run(container, size);
+                built() = size;
+            }
+            return Container();
+        }
+
+        inline static void clean(){
+            std::remove(path().c_str());
+            built() = 0;
+        }
+    };
+
+    template<class Container>
+    struct Reopen {
+        inline static void run(Container &c, std::size_t){
+            c = Container::open(Create<Container>::path());
+        }
+    };
+};
+
 // testing policies
 
+// Reserve faulted in memory for sw::prefault_allocator before building the
+// container: four times the elements covers the growth of the contiguous
+// containers on a bump allocator, plus a node overhead for the others
+
+static const std::size_t PREFAULT_NODE_OVERHEAD = 64;
+
+template<template<class> class CreatePolicy>
+struct Prefaulted {
+    template<class Container>
+    struct Create {
+        inline static Container make(std::size_t size){
+            sw::prefault_allocator::reserve(size * (4 * sizeof(typename Container::value_type) + PREFAULT_NODE_OVERHEAD) + (1u << 20));
+            return CreatePolicy<Container>::make(size);
+        }
+
+        inline static void clean(){
+            CreatePolicy<Container>::clean();
+        }
+    };
+};
+
+// memory resource create policies, the container is built with a fresh
+// resource of the given kind installed as the default resource
+
+enum class Resource {
+    MONOTONIC,
+    UNSYNCHRONIZED_POOL,
+    SYNCHRONIZED_POOL
+};
+
+template<Resource Kind, template<class> class CreatePolicy>
+struct WithResource {
+    template<class Container>
+    struct Create {
+        static std::unique_ptr<std::pmr::memory_resource>& resource(){
+            static std::unique_ptr<std::pmr::memory_resource> r;
+            return r;
+        }
+
+        inline static Container make(std::size_t size){
+            // the previous container is destroyed, start over from an empty resource
+            std::pmr::set_default_resource(nullptr);
+            if(Kind == Resource::MONOTONIC){
+                resource().reset(new std::pmr::monotonic_buffer_resource());
+            } else if(Kind == Resource::UNSYNCHRONIZED_POOL){
+                resource().reset(new std::pmr::unsynchronized_pool_resource());
+            } else {
+                resource().reset(new std::pmr::synchronized_pool_resource());
+            }
+            std::pmr::set_default_resource(resource().get());
+
+            return CreatePolicy<Container>::make(size);
+        }
+
+        inline static void clean(){
+            CreatePolicy<Container>::clean();
+            std::pmr::set_default_resource(nullptr);
+            resource().reset();
+        }
+    };
+};
+
 template<class Container>
 struct NoOp {
     inline static void run(Container &, std::size_t) {
@@ -309,6 +619,36 @@ struct PushBack {
 template <class Container>
 const typename Container::value_type PushBack<Container>::value{};
 
+// frame loop policies, the container is reused across frames
+
+template<class Container>
+struct ClearPushBack {
+    static const typename Container::value_type value;
+    inline static void run(Container &c, std::size_t size){
+        c.clear();
+        for(size_t i=0; i<size; ++i){
+            c.push_back(value);
+        }
+    }
+};
+
+template<class Container>
+const typename Container::value_type ClearPushBack<Container>::value{};
+
+template<class Container>
+struct ClearInsert {
+    static const typename Container::value_type value;
+    inline static void run(Container &c, std::size_t size){
+        c.clear();
+        for(size_t i=0; i<size; ++i){
+            c.insert(value);
+        }
+    }
+};
+
+template<class Container>
+const typename Container::value_type ClearInsert<Container>::value{};
+
 template<class Container>
 struct Write {
     inline static void run(Container &c, std::size_t){
@@ -321,6 +661,30 @@ struct Write {
     }
 };
 
+// Write over the contiguous runs of a colony
+template<class Container>
+struct WriteRuns {
+    inline static void run(Container &c, std::size_t){
+        c.for_each_run([](typename Container::value_type* first, typename Container::value_type* last){
+            for(; first != last; ++first){
+                ++(first->a);
+            }
+        });
+    }
+};
+
+// Write over every lane of the float vector types, vectorised by the compiler
+template<class Container>
+struct WriteLanes {
+    inline static void run(Container &c, std::size_t){
+        for(auto& obj : c){
+            for(std::size_t lane = 0; lane < sizeof(obj.v) / sizeof(obj.v[0]); ++lane){
+                obj.v[lane] += 1.0f;
+            }
+        }
+    }
+};
+
 template<class Container>
 struct IterateRead {
     static typename Container::value_type value;
@@ -339,6 +703,253 @@ struct IterateRead {
 template <class Container>
 typename Container::value_type IterateRead<Container>::value{};
 
+template<class Container>
+struct IterateReadRuns {
+    static typename Container::value_type value;
+    inline static void run(Container &c, std::size_t){
+        c.for_each_run([](const typename Container::value_type* first, const typename Container::value_type* last){
+            for(; first != last; ++first){
+                std::memcpy(&value, first, 1);
+            }
+        });
+    }
+};
+
+template <class Container>
+typename Container::value_type IterateReadRuns<Container>::value{};
+
+// parallel iteration policies, run on bench_pool() over the ranges made by
+// Partitioned when the container was created
+
+template<class Bench>
+struct ParallelRead {
+    static std::atomic<std::size_t> sum;
+    inline static void run(Bench &b, std::size_t){
+        using iterator = typename Bench::Container::iterator;
+        parallel_for_partition(b.ranges, *bench_pool(), [](iterator first, iterator last){
+            std::size_t local = 0;
+            for(; first != last; ++first){
+                local += first->a;
+            }
+            sum += local;
+        });
+    }
+};
+
+template <class Bench>
+std::atomic<std::size_t> ParallelRead<Bench>::sum{0};
+
+template<class Bench>
+struct ParallelWrite {
+    inline static void run(Bench &b, std::size_t){
+        parallel_for_each_partition(b.ranges, *bench_pool(), [](typename Bench::Container::value_type& v){ ++v.a; });
+    }
+};
+
+template<class Bench>
+struct ParallelTransform {
+    inline static void run(Bench &b, std::size_t){
+        parallel_for_each_partition(b.ranges, *bench_pool(), [](typename Bench::Container::value_type& v){ v.a = v.a * 31 + (v.a >> 3); });
+    }
+};
+
+// std::execution::par reference, the thread count is chosen by the library
+
+template<class Container>
+struct StdParallelRead {
+    static std::size_t sum;
+    inline static void run(Container &c, std::size_t){
+        sum += std::transform_reduce(std::execution::par, c.begin(), c.end(), std::size_t(0), std::plus<std::size_t>(), [](const typename Container::value_type& v){ return v.a; });
+    }
+};
+
+template <class Container>
+std::size_t StdParallelRead<Container>::sum = 0;
+
+template<class Container>
+struct StdParallelWrite {
+    inline static void run(Container &c, std::size_t){
+        std::for_each(std::execution::par, c.begin(), c.end(), [](typename Container::value_type& v){ ++v.a; });
+    }
+};
+
+template<class Container>
+struct StdParallelTransform {
+    inline static void run(Container &c, std::size_t){
+        std::for_each(std::execution::par, c.begin(), c.end(), [](typename Container::value_type& v){ v.a = v.a * 31 + (v.a >> 3); });
+    }
+};
+
+// compute kernels, each one written once over a range so it can run over
+// the container iterators or over the contiguous spans of for_each_span
+
+// sum every byte of the elements, ie. all the fields of a Trivial<N>
+template<typename Iterator>
+std::size_t sum_fields(Iterator first, Iterator last){
+    std::size_t sum = 0;
+    for(; first != last; ++first){
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&*first);
+        for(std::size_t i = 0; i < sizeof(*first); ++i){
+            sum += bytes[i];
+        }
+    }
+    return sum;
+}
+
+template<typename Iterator>
+void integrate(Iterator first, Iterator last, float dt){
+    for(; first != last; ++first){
+        for(std::size_t i = 0; i < 3; ++i){
+            first->position[i] += first->velocity[i] * dt;
+        }
+    }
+}
+
+template<typename Iterator>
+void conditional_update(Iterator first, Iterator last){
+    for(; first != last; ++first){
+        if(first->a % 3 == 0){
+            first->a += 7;
+        }
+    }
+}
+
+// returns false once sum reached limit
+template<typename Iterator>
+bool reduce_until(Iterator first, Iterator last, std::size_t limit, std::size_t& sum){
+    for(; first != last; ++first){
+        sum += first->a;
+        if(sum >= limit){
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class Container>
+struct SumFields {
+    static std::size_t sum;
+    inline static void run(Container &c, std::size_t){
+        sum += sum_fields(c.begin(), c.end());
+    }
+};
+
+template <class Container>
+std::size_t SumFields<Container>::sum = 0;
+
+template<class Container>
+struct SumFieldsSpan {
+    static std::size_t sum;
+    inline static void run(Container &c, std::size_t){
+        for_each_span(c, [](const typename Container::value_type* first, const typename Container::value_type* last){
+            sum += sum_fields(first, last);
+            return true;
+        });
+    }
+};
+
+template <class Container>
+std::size_t SumFieldsSpan<Container>::sum = 0;
+
+template<class Container>
+struct Integrate {
+    inline static void run(Container &c, std::size_t){
+        integrate(c.begin(), c.end(), 0.016f);
+    }
+};
+
+template<class Container>
+struct IntegrateSpan {
+    inline static void run(Container &c, std::size_t){
+        for_each_span(c, [](typename Container::value_type* first, typename Container::value_type* last){
+            integrate(first, last, 0.016f);
+            return true;
+        });
+    }
+};
+
+template<class Container>
+struct ConditionalUpdate {
+    inline static void run(Container &c, std::size_t){
+        conditional_update(c.begin(), c.end());
+    }
+};
+
+template<class Container>
+struct ConditionalUpdateSpan {
+    inline static void run(Container &c, std::size_t){
+        for_each_span(c, [](typename Container::value_type* first, typename Container::value_type* last){
+            conditional_update(first, last);
+            return true;
+        });
+    }
+};
+
+// the keys are a permutation of [0, size), stop about halfway through
+template<class Container>
+struct ReduceEarlyExit {
+    static std::size_t sum;
+    inline static void run(Container &c, std::size_t size){
+        std::size_t local = 0;
+        reduce_until(c.begin(), c.end(), size * size / 4, local);
+        sum += local;
+    }
+};
+
+template <class Container>
+std::size_t ReduceEarlyExit<Container>::sum = 0;
+
+template<class Container>
+struct ReduceEarlyExitSpan {
+    static std::size_t sum;
+    inline static void run(Container &c, std::size_t size){
+        std::size_t local = 0;
+        for_each_span(c, [&](const typename Container::value_type* first, const typename Container::value_type* last){
+            return reduce_until(first, last, size * size / 4, local);
+        });
+        sum += local;
+    }
+};
+
+template <class Container>
+std::size_t ReduceEarlyExitSpan<Container>::sum = 0;
+
+// reverse traversal policies
+
+template<class Container>
+struct ReverseWrite {
+    inline static void run(Container &c, std::size_t){
+        using std::rbegin;
+        using std::rend;
+        auto it = rbegin(c);
+        auto end = rend(c);
+
+        for(; it != end; ++it){
+            ++(it->a);
+        }
+    }
+};
+
+template<class Container>
+struct ReverseIterateRead {
+    static typename Container::value_type value;
+    inline static void run(Container &c, std::size_t){
+        using std::rbegin;
+        using std::rend;
+        auto it = rbegin(c);
+        auto end = rend(c);
+
+        while(it != end){
+            auto& obj = *it;
+            std::memcpy(&value, &obj, 1);
+            ++it;
+        }
+    }
+};
+
+template <class Container>
+typename Container::value_type ReverseIterateRead<Container>::value{};
+
 template<class Container>
 struct RandomReadIntegerIndex {
     static typename Container::Container::value_type value;
@@ -400,6 +1011,158 @@ struct RandomReadClusterMap {
 template <class Container>
 typename Container::Container::value_type RandomReadClusterMap<Container>::value{};
 
+// batched random reads, prefetching prefetch_distance handles ahead
+
+template<class Container>
+struct GatherIntegerIndex {
+    static typename Container::Container::value_type value;
+    template<typename HandleIt>
+    inline static void gather_range(Container &c, HandleIt first, HandleIt last, std::size_t distance){
+        gather(first, last, distance,
+            [&](std::size_t i){ return &c.container[i]; },
+            [](const typename Container::Container::value_type& obj){ std::memcpy(&value, &obj, 1); });
+    }
+
+    inline static void run(Container &c, std::size_t){
+        gather_range(c, c.handles.begin(), c.handles.end(), c.prefetch_distance);
+    }
+};
+
+template <class Container>
+typename Container::Container::value_type GatherIntegerIndex<Container>::value{};
+
+template<class Container>
+struct GatherIterators {
+    static typename Container::Container::value_type value;
+    template<typename HandleIt>
+    inline static void gather_range(Container &, HandleIt first, HandleIt last, std::size_t distance){
+        gather(first, last, distance,
+            [](const typename Container::Handle& it){ return &*it; },
+            [](const typename Container::Container::value_type& obj){ std::memcpy(&value, &obj, 1); });
+    }
+
+    inline static void run(Container &c, std::size_t){
+        gather_range(c, c.handles.begin(), c.handles.end(), c.prefetch_distance);
+    }
+};
+
+template <class Container>
+typename Container::Container::value_type GatherIterators<Container>::value{};
+
+// Output iterator keeping the first byte of every value written to it, the
+// same sink as the other gather policies
+template<typename T>
+struct FirstByteSink {
+    T* value;
+
+    FirstByteSink& operator*(){ return *this; }
+    FirstByteSink& operator++(){ return *this; }
+    FirstByteSink& operator++(int){ return *this; }
+
+    FirstByteSink& operator=(const T& obj){
+        std::memcpy(value, &obj, 1);
+        return *this;
+    }
+};
+
+template<class Container>
+struct GatherClusterMap {
+    static typename Container::Container::value_type value;
+    template<typename HandleIt>
+    inline static void gather_range(Container &c, HandleIt first, HandleIt last, std::size_t distance){
+        sw::at_batch(c.container, first, last, FirstByteSink<typename Container::Container::value_type>{&value}, distance);
+    }
+
+    inline static void run(Container &c, std::size_t){
+        gather_range(c, c.handles.begin(), c.handles.end(), c.prefetch_distance);
+    }
+};
+
+template <class Container>
+typename Container::Container::value_type GatherClusterMap<Container>::value{};
+
+// random reads interleaved as Group coroutine lookups in flight
+
+template<std::size_t Group>
+struct Interleaved {
+    template<class Container>
+    struct Iterators {
+        static typename Container::Container::value_type value;
+        inline static void run(Container &c, std::size_t){
+            interleave(c.handles.begin(), c.handles.end(), Group,
+                [](const typename Container::Handle& it){ return &*it; },
+                [](const typename Container::Container::value_type& obj){ std::memcpy(&value, &obj, 1); });
+        }
+    };
+
+    template<class Container>
+    struct ClusterMap {
+        static typename Container::Container::value_type value;
+        inline static void run(Container &c, std::size_t){
+            interleave(c.handles.begin(), c.handles.end(), Group,
+                [&](const typename Container::Handle& handle){ return &c.container.at(handle); },
+                [](const typename Container::Container::value_type& obj){ std::memcpy(&value, &obj, 1); });
+        }
+    };
+};
+
+template<std::size_t Group>
+template<class Container>
+typename Container::Container::value_type Interleaved<Group>::Iterators<Container>::value{};
+
+template<std::size_t Group>
+template<class Container>
+typename Container::Container::value_type Interleaved<Group>::ClusterMap<Container>::value{};
+
+// Pick the fastest prefetch distance of a Gather policy. Each candidate is
+// timed on its own windows of handles so it does not run on a warmed cache,
+// over several rounds in shuffled order so that no candidate always gets the
+// first window after the fill
+template<class Gather, class Container>
+std::size_t tune_prefetch_distance(Container &c){
+    const std::size_t candidates[] = { 0, 2, 4, 8, 16, 32, 64 };
+    const std::size_t count = sizeof(candidates) / sizeof(candidates[0]);
+    const std::size_t rounds = 4;
+    const std::size_t window = std::min<std::size_t>(c.handles.size() / (count * rounds), 4096);
+
+    std::vector<std::size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<Clock::duration> durations(count, Clock::duration::zero());
+
+    std::mt19937 generator;
+    auto first = c.handles.begin();
+    for(std::size_t round = 0; round < rounds; ++round){
+        std::shuffle(order.begin(), order.end(), generator);
+
+        for(auto i : order){
+            Clock::time_point t0 = Clock::now();
+            Gather::gather_range(c, first, first + window, candidates[i]);
+            Clock::time_point t1 = Clock::now();
+
+            durations[i] += t1 - t0;
+            first += window;
+        }
+    }
+
+    return candidates[std::min_element(durations.begin(), durations.end()) - durations.begin()];
+}
+
+template<template<class> class CreatePolicy, template<class> class Gather>
+struct PrefetchTuned {
+    template<class Container>
+    struct Create {
+        inline static Container make(std::size_t size){
+            Container pack = CreatePolicy<Container>::make(size);
+            pack.prefetch_distance = tune_prefetch_distance<Gather<Container>>(pack);
+            return pack;
+        }
+
+        inline static void clean(){
+            CreatePolicy<Container>::clean();
+        }
+    };
+};
+
 template<class Container>
 struct Erase {
     inline static void run(Container &c, std::size_t){
@@ -420,6 +1183,63 @@ struct EraseCluster {
     }
 };
 
+// Allocation churn: CHURN_ROUNDS times, erase every handle in random order
+// then insert them all again, so whole chunks are released and reacquired
+
+static const std::size_t CHURN_ROUNDS = 4;
+
+template<class Container>
+struct Churn {
+    static const typename Container::Container::value_type value;
+    inline static void run(Container &c, std::size_t){
+        for(std::size_t round = 0; round < CHURN_ROUNDS; ++round){
+            for(auto handle : c.handles){
+                c.container.erase(handle);
+            }
+            for(auto& handle : c.handles){
+                handle = c.container.insert(value);
+            }
+        }
+    }
+};
+
+template<class Container>
+const typename Container::Container::value_type Churn<Container>::value{};
+
+// Partial churn: CHURN_ROUNDS times, erase a random quarter of the handles
+// then insert as many elements again. Groups practically never empty, so the
+// erased slots are reused instead of released
+
+template<class Container>
+struct EraseQuarter {
+    inline static void run(Container &c, std::size_t){
+        const std::size_t quarter = c.handles.size() / 4;
+        for(std::size_t i = 0; i < quarter; ++i){
+            c.container.erase(c.handles[i]);
+        }
+    }
+};
+
+template<class Container>
+struct ChurnQuarter {
+    static const typename Container::Container::value_type value;
+    inline static void run(Container &c, std::size_t){
+        const std::size_t quarter = c.handles.size() / 4;
+        for(std::size_t round = 0; round < CHURN_ROUNDS; ++round){
+            auto first = c.handles.begin() + (round % 4) * quarter;
+            for(auto it = first; it != first + quarter; ++it){
+                c.container.erase(*it);
+            }
+            for(auto it = first; it != first + quarter; ++it){
+                *it = c.container.insert(value);
+            }
+        }
+    }
+};
+
+template<class Container>
+const typename Container::Container::value_type ChurnQuarter<Container>::value{};
+
 template<class Container>
 struct RemoveErase {
     inline static void run(Container &c, std::size_t){
@@ -436,6 +1256,47 @@ struct RemoveEraseCluster {
     }
 };
 
+// Concurrent workload: 40% insert, 20% erase and 40% read, each thread only
+// erases and reads the handles it inserted
+
+template<class Pool>
+struct MixedInsertEraseRead {
+    static std::atomic<std::size_t> sum;
+    inline static void run(Pool &pool, std::size_t thread, std::size_t ops, std::vector<std::size_t> &latencies){
+        std::mt19937 generator(static_cast<unsigned int>(thread));
+        std::uniform_int_distribution<std::size_t> distribution(0, 99);
+
+        std::vector<typename Pool::handle_type> handles;
+        handles.reserve(ops);
+
+        std::size_t local = 0;
+        for(std::size_t i = 0; i < ops; ++i){
+            std::size_t operation = distribution(generator);
+
+            Clock::time_point t0 = Clock::now();
+
+            if(operation < 40 || handles.empty()){
+                handles.push_back(pool.insert(thread, typename Pool::value_type{i}));
+            } else if(operation < 60){
+                std::size_t index = generator() % handles.size();
+                pool.erase(thread, handles[index]);
+                handles[index] = handles.back();
+                handles.pop_back();
+            } else {
+                local += pool.read(thread, handles[generator() % handles.size()]);
+            }
+
+            Clock::time_point t1 = Clock::now();
+            latencies.push_back(std::chrono::duration_cast<nanoseconds>(t1 - t0).count());
+        }
+
+        sum += local;
+    }
+};
+
+template <class Pool>
+std::atomic<std::size_t> MixedInsertEraseRead<Pool>::sum{0};
+
 //Sort the container
 
 template<class Container>
@@ -506,6 +1367,40 @@ struct RandomSortedInsert {
 template<class Container> std::mt19937 RandomSortedInsert<Container>::generator;
 template<class Container> std::uniform_int_distribution<std::size_t> RandomSortedInsert<Container>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
 
+// Same as RandomSortedInsert with an O(log n) search, for random access containers
+template<class Container>
+struct RandomSortedInsertBinary {
+    static std::mt19937 generator;
+    static std::uniform_int_distribution<std::size_t> distribution;
+
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i){
+            auto val = distribution(generator);
+            // hand written comparison to eliminate temporary object creation
+            c.insert(std::upper_bound(begin(c), end(c), val, [](std::size_t v, decltype(*begin(c)) e){ return v < e.a; }), typename Container::value_type{val});
+        }
+    }
+};
+
+template<class Container> std::mt19937 RandomSortedInsertBinary<Container>::generator;
+template<class Container> std::uniform_int_distribution<std::size_t> RandomSortedInsertBinary<Container>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
+
+// Containers which keep themselves ordered (sorted_chunk_vector, multiset)
+template<class Container>
+struct RandomSortedInsertOrdered {
+    static std::mt19937 generator;
+    static std::uniform_int_distribution<std::size_t> distribution;
+
+    inline static void run(Container &c, std::size_t size){
+        for(std::size_t i=0; i<size; ++i){
+            c.insert(typename Container::value_type{distribution(generator)});
+        }
+    }
+};
+
+template<class Container> std::mt19937 RandomSortedInsertOrdered<Container>::generator;
+template<class Container> std::uniform_int_distribution<std::size_t> RandomSortedInsertOrdered<Container>::distribution(0, std::numeric_limits<std::size_t>::max() - 1);
+
 
 template<class Container>
 struct RandomErase10 {
@@ -582,3 +1477,207 @@ struct Traversal {
         }
     }
 };
+
+// runtime stride policies, the benchmark size is the element size in bytes
+// and every container holds STRIDE_ELEMENTS elements
+
+static const std::size_t STRIDE_ELEMENTS = 10000;
+
+template<typename StrideContainer>
+struct StrideBenchType
+{
+    StrideBenchType(size_t stride)
+        : container(stride)
+        , handles()
+    {
+        handles.reserve(STRIDE_ELEMENTS);
+    }
+
+    using Container = StrideContainer;
+    using Handle = typename StrideContainer::handle_type;
+
+    StrideContainer container;
+    std::vector<Handle> handles;
+};
+
+template<class Container>
+struct EmptyStride {
+    inline static Container make(std::size_t stride) {
+        return Container(stride);
+    }
+
+    inline static void clean(){
+    }
+};
+
+template<class Container>
+struct FilledRandomStride {
+    inline static Container make(std::size_t stride){
+        // Get accessors in randomised order
+        Container pack(stride);
+        for(std::size_t i = 0; i < STRIDE_ELEMENTS; ++i){
+            pack.handles.push_back(pack.container.push_back());
+        }
+        std::shuffle(begin(pack.handles), end(pack.handles), std::mt19937());
+
+        return pack;
+    }
+
+    inline static void clean(){
+    }
+};
+
+template<class Container>
+struct StrideFillBack {
+    inline static void run(Container &c, std::size_t){
+        for(std::size_t i = 0; i < STRIDE_ELEMENTS; ++i){
+            c.container.push_back();
+        }
+    }
+};
+
+template<class Container>
+struct StrideIterateRead {
+    static std::byte value;
+    inline static void run(Container &c, std::size_t){
+        c.container.for_each([](const std::byte* slot){ std::memcpy(&value, slot, 1); });
+    }
+};
+
+template<class Container>
+std::byte StrideIterateRead<Container>::value{};
+
+template<class Container>
+struct StrideRandomRead {
+    static std::byte value;
+    inline static void run(Container &c, std::size_t){
+        for(auto handle : c.handles){
+            std::memcpy(&value, c.container.at(handle), 1);
+        }
+    }
+};
+
+template<class Container>
+std::byte StrideRandomRead<Container>::value{};
+
+// struct of arrays policies, field 0 is the hot field the other policies
+// reach through ->a
+
+template<class Container>
+struct FilledRandomSoa {
+    inline static Container make(std::size_t size){
+        // Get accessors in randomised order
+        Container pack(size);
+        for(std::size_t i = 0; i < size; ++i){
+            pack.handles.push_back(pack.container.insert(typename Container::Container::value_type{}));
+        }
+        std::shuffle(begin(pack.handles), end(pack.handles), std::mt19937());
+
+        return pack;
+    }
+
+    inline static void clean(){
+    }
+};
+
+template<class Container>
+struct SoaIterateRead {
+    static std::size_t value;
+    inline static void run(Container &c, std::size_t){
+        c.container.template for_each<0>([](const std::size_t& a){ std::memcpy(&value, &a, 1); });
+    }
+};
+
+template<class Container>
+std::size_t SoaIterateRead<Container>::value{};
+
+template<class Container>
+struct SoaWrite {
+    inline static void run(Container &c, std::size_t){
+        c.container.template for_each<0>([](std::size_t& a){ ++a; });
+    }
+};
+
+template<class Container>
+struct SoaRandomRead {
+    static std::size_t value;
+    inline static void run(Container &c, std::size_t){
+        for(auto handle : c.handles){
+            std::memcpy(&value, &c.container.template get<0>(handle), 1);
+        }
+    }
+};
+
+template<class Container>
+std::size_t SoaRandomRead<Container>::value{};
+
+// polymorphic policies, every container holds a random mix of the Derived
+// types in insertion order
+
+template<typename Base, typename Derived>
+void poly_insert(std::vector<std::unique_ptr<Base>>& c, const Derived& value){
+    c.push_back(std::make_unique<Derived>(value));
+}
+
+template<typename Base, typename Derived>
+void poly_insert(plf::colony<std::unique_ptr<Base>>& c, const Derived& value){
+    c.insert(std::make_unique<Derived>(value));
+}
+
+template<typename Base, typename Allocator, typename... Types, typename Derived>
+void poly_insert(sw::poly_cluster<Base, Allocator, Types...>& c, const Derived& value){
+    c.insert(value);
+}
+
+template<typename... Derived>
+struct FilledRandomPolymorphic {
+    template<class Container>
+    struct Create {
+        template<typename T>
+        inline static void insert(Container& c, std::size_t i){
+            poly_insert(c, T(i));
+        }
+
+        inline static Container make(std::size_t size){
+            using inserter = void(*)(Container&, std::size_t);
+            static const inserter inserters[] = { &insert<Derived>... };
+
+            // same type sequence for every container
+            std::mt19937 generator;
+            std::uniform_int_distribution<std::size_t> distribution(0, sizeof...(Derived) - 1);
+
+            Container container;
+            for(std::size_t i = 0; i < size; ++i){
+                inserters[distribution(generator)](container, i);
+            }
+
+            return container;
+        }
+
+        inline static void clean(){
+        }
+    };
+};
+
+template<class Container>
+struct UpdateVirtual {
+    inline static void run(Container &c, std::size_t){
+        for(auto& object : c){
+            object->update();
+        }
+    }
+};
+
+template<class Container>
+struct UpdateSegregated {
+    inline static void run(Container &c, std::size_t){
+        c.for_each([](auto& object){ object.update(); });
+    }
+};
+
+template<class Container>
+struct UpdateSegregatedVirtual {
+    inline static void run(Container &c, std::size_t){
+        c.for_each_base([](auto& object){ object.update(); });
+    }
+};
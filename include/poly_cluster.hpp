@@ -0,0 +1,77 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_POLY_CLUSTER
+#define CLUSTERBENCH_POLY_CLUSTER
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <ClusterVector.h>
+
+namespace sw {
+
+// Polymorphic objects segregated by dynamic type, one cluster_vector per
+// type of the closed list Types. Objects are stored by value, and for_each
+// visits the clusters one after the other with the static type of their
+// elements, so calls on final types are devirtualised and each loop only
+// ever takes one branch target.
+template<typename Base, typename Allocator, typename... Types>
+class poly_cluster {
+    static_assert((std::is_base_of<Base, Types>::value && ...), "poly_cluster: every type must derive from Base");
+
+    public:
+        template<typename T>
+        using cluster_type = cluster_vector<T, Allocator>;
+
+        template<typename T>
+        typename cluster_type<T>::iterator insert(const T& value){
+            ++count;
+            return cluster<T>().push_back(value);
+        }
+
+        // The cluster holding the objects of dynamic type T
+        template<typename T>
+        cluster_type<T>& cluster(){
+            return std::get<cluster_type<T>>(clusters);
+        }
+
+        // Call f(object) with the static type of each object, type by type
+        template<typename Function>
+        void for_each(Function f){
+            std::apply([&](auto&... typed){ (for_each_in(typed, f), ...); }, clusters);
+        }
+
+        // Call f(object) through a Base reference, in the same order
+        template<typename Function>
+        void for_each_base(Function f){
+            for_each([&](Base& object){ f(object); });
+        }
+
+        void clear(){
+            std::apply([](auto&... typed){ (typed.clear(), ...); }, clusters);
+            count = 0;
+        }
+
+        std::size_t size() const { return count; }
+
+    private:
+        template<typename Cluster, typename Function>
+        static void for_each_in(Cluster& typed, Function& f){
+            for(auto& object : typed){
+                f(object);
+            }
+        }
+
+        std::tuple<cluster_type<Types>...> clusters;
+        std::size_t count = 0;
+};
+
+} //end of namespace sw
+
+#endif
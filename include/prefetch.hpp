@@ -0,0 +1,53 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_PREFETCH
+#define CLUSTERBENCH_PREFETCH
+
+#include <cstddef>
+
+#if !defined(__GNUC__)
+#include <xmmintrin.h>
+#endif
+
+inline void prefetch(const void* p){
+#if defined(__GNUC__)
+    __builtin_prefetch(p);
+#else
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#endif
+}
+
+// Call f(*resolve(h)) for every handle h of [first, last), prefetching the
+// element distance handles ahead so that several cache misses are in flight
+// at once. resolve turns a handle into an element pointer without reading
+// the element.
+template<typename HandleIt, typename Resolve, typename Function>
+void gather(HandleIt first, HandleIt last, std::size_t distance, Resolve resolve, Function f){
+    if(distance == 0){
+        for(; first != last; ++first){
+            f(*resolve(*first));
+        }
+        return;
+    }
+
+    HandleIt ahead = first;
+    for(std::size_t i = 0; i < distance && ahead != last; ++i, ++ahead){
+        prefetch(resolve(*ahead));
+    }
+
+    for(; ahead != last; ++first, ++ahead){
+        prefetch(resolve(*ahead));
+        f(*resolve(*first));
+    }
+
+    for(; first != last; ++first){
+        f(*resolve(*first));
+    }
+}
+
+#endif
@@ -0,0 +1,114 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_SOA_CLUSTER
+#define CLUSTERBENCH_SOA_CLUSTER
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace sw {
+
+// Struct of arrays cluster: an element is a list of fields and every chunk
+// stores each field in its own array, so a loop over some fields only pulls
+// those fields through the cache. Chunks are never moved and erased slots
+// are reused, so handles stay valid until their element is erased.
+template<typename... Fields>
+class soa_cluster {
+    public:
+        static constexpr std::size_t chunk_size = 1024;
+
+        using value_type = std::tuple<Fields...>;
+        using handle_type = std::uint32_t;
+
+        handle_type insert(const Fields&... values){
+            handle_type handle;
+            if(!free_slots.empty()){
+                handle = free_slots.back();
+                free_slots.pop_back();
+            } else {
+                if(filled % chunk_size == 0){
+                    chunks.emplace_back(new chunk());
+                }
+                handle = static_cast<handle_type>(filled++);
+            }
+
+            chunk& ch = *chunks[handle / chunk_size];
+            assign(ch, handle % chunk_size, std::index_sequence_for<Fields...>(), values...);
+            ch.live[handle % chunk_size] = 1;
+            ++count;
+
+            return handle;
+        }
+
+        handle_type insert(const value_type& value){
+            return std::apply([this](const Fields&... values){ return insert(values...); }, value);
+        }
+
+        void erase(handle_type handle){
+            chunks[handle / chunk_size]->live[handle % chunk_size] = 0;
+            free_slots.push_back(handle);
+            --count;
+        }
+
+        // Field I of the element of a handle
+        template<std::size_t I>
+        auto& get(handle_type handle){
+            return std::get<I>(chunks[handle / chunk_size]->columns)[handle % chunk_size];
+        }
+
+        // Call f(field<I>...) on every element, only the arrays of the
+        // requested fields are touched
+        template<std::size_t... I, typename Function>
+        void for_each(Function f){
+            std::size_t remaining = filled;
+            for(auto& ch : chunks){
+                std::size_t slots = remaining < chunk_size ? remaining : chunk_size;
+                for(std::size_t slot = 0; slot < slots; ++slot){
+                    if(ch->live[slot]){
+                        f(std::get<I>(ch->columns)[slot]...);
+                    }
+                }
+                remaining -= slots;
+            }
+        }
+
+        void clear(){
+            chunks.clear();
+            free_slots.clear();
+            filled = 0;
+            count = 0;
+        }
+
+        std::size_t size() const { return count; }
+        std::size_t chunk_count() const { return chunks.size(); }
+
+    private:
+        struct chunk {
+            std::tuple<std::array<Fields, chunk_size>...> columns;
+            std::array<std::uint8_t, chunk_size> live{};
+        };
+
+        template<std::size_t... I>
+        static void assign(chunk& ch, std::size_t slot, std::index_sequence<I...>, const Fields&... values){
+            ((std::get<I>(ch.columns)[slot] = values), ...);
+        }
+
+        std::vector<std::unique_ptr<chunk>> chunks;
+        std::vector<handle_type> free_slots;
+        std::size_t filled = 0;
+        std::size_t count = 0;
+};
+
+} //end of namespace sw
+
+#endif
@@ -0,0 +1,177 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_SORTED_CHUNK_VECTOR
+#define CLUSTERBENCH_SORTED_CHUNK_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace sw {
+
+// Sorted sequence stored as an ordered index of fixed capacity sorted chunks
+// (a two level B+tree). Lookups binary search the chunk index then the chunk,
+// and an insertion only shifts elements within a single chunk, splitting it
+// in half when it is full.
+template<typename T, typename Compare = std::less<T>, std::size_t ChunkBytes = 4096>
+class sorted_chunk_vector {
+    public:
+        static constexpr std::size_t chunk_capacity = ChunkBytes / sizeof(T) < 16 ? 16 : ChunkBytes / sizeof(T);
+
+    private:
+        using chunk_type = std::vector<T>;
+        using index_type = std::vector<chunk_type>;
+
+        template<typename Index, typename Value>
+        class iterator_base {
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Value*;
+                using reference = Value&;
+
+                iterator_base() = default;
+                iterator_base(Index* index, std::size_t chunk, std::size_t element) : index(index), chunk(chunk), element(element) {}
+
+                template<typename OtherIndex, typename OtherValue>
+                iterator_base(const iterator_base<OtherIndex, OtherValue>& other) : index(other.index), chunk(other.chunk), element(other.element) {}
+
+                reference operator*() const { return (*index)[chunk][element]; }
+                pointer operator->() const { return &(*index)[chunk][element]; }
+
+                iterator_base& operator++(){
+                    if(++element == (*index)[chunk].size()){
+                        ++chunk;
+                        element = 0;
+                    }
+                    return *this;
+                }
+
+                iterator_base operator++(int){
+                    iterator_base copy(*this);
+                    ++*this;
+                    return copy;
+                }
+
+                iterator_base& operator--(){
+                    if(element == 0){
+                        --chunk;
+                        element = (*index)[chunk].size();
+                    }
+                    --element;
+                    return *this;
+                }
+
+                iterator_base operator--(int){
+                    iterator_base copy(*this);
+                    --*this;
+                    return copy;
+                }
+
+                bool operator==(const iterator_base& other) const { return chunk == other.chunk && element == other.element; }
+                bool operator!=(const iterator_base& other) const { return !(*this == other); }
+
+            private:
+                template<typename, typename> friend class iterator_base;
+                friend class sorted_chunk_vector;
+
+                Index* index = nullptr;
+                std::size_t chunk = 0;
+                std::size_t element = 0;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using value_compare = Compare;
+        using iterator = iterator_base<index_type, T>;
+        using const_iterator = iterator_base<const index_type, const T>;
+
+        sorted_chunk_vector() = default;
+        explicit sorted_chunk_vector(const Compare& compare) : compare(compare) {}
+
+        iterator insert(const T& value){
+            if(chunks.empty()){
+                chunks.emplace_back();
+                chunks.back().reserve(chunk_capacity);
+            }
+
+            std::size_t chunk = upper_chunk(value);
+            if(chunks[chunk].size() == chunk_capacity){
+                split(chunk);
+                if(!compare(value, chunks[chunk + 1].front())){
+                    ++chunk;
+                }
+            }
+
+            chunk_type& target = chunks[chunk];
+            auto position = target.insert(std::upper_bound(target.begin(), target.end(), value, compare), value);
+            ++count;
+
+            return iterator(&chunks, chunk, static_cast<std::size_t>(position - target.begin()));
+        }
+
+        iterator lower_bound(const T& value){
+            const_iterator it = static_cast<const sorted_chunk_vector&>(*this).lower_bound(value);
+            return iterator(&chunks, it.chunk, it.element);
+        }
+
+        const_iterator lower_bound(const T& value) const {
+            auto chunk = std::partition_point(chunks.begin(), chunks.end(), [&](const chunk_type& c){ return compare(c.back(), value); });
+            if(chunk == chunks.end()){
+                return end();
+            }
+
+            auto element = std::lower_bound(chunk->begin(), chunk->end(), value, compare);
+            return const_iterator(&chunks, static_cast<std::size_t>(chunk - chunks.begin()), static_cast<std::size_t>(element - chunk->begin()));
+        }
+
+        iterator begin(){ return iterator(&chunks, 0, 0); }
+        iterator end(){ return iterator(&chunks, chunks.size(), 0); }
+        const_iterator begin() const { return const_iterator(&chunks, 0, 0); }
+        const_iterator end() const { return const_iterator(&chunks, chunks.size(), 0); }
+
+        size_type size() const { return count; }
+        bool empty() const { return count == 0; }
+        size_type chunk_count() const { return chunks.size(); }
+
+        void clear(){
+            chunks.clear();
+            count = 0;
+        }
+
+    private:
+        // First chunk that may receive value while keeping equal elements in insertion order
+        std::size_t upper_chunk(const T& value) const {
+            auto chunk = std::partition_point(chunks.begin(), chunks.end() - 1, [&](const chunk_type& c){ return !compare(value, c.back()); });
+            return static_cast<std::size_t>(chunk - chunks.begin());
+        }
+
+        void split(std::size_t chunk){
+            chunks.emplace(chunks.begin() + chunk + 1);
+
+            chunk_type& full = chunks[chunk];
+            chunk_type& upper = chunks[chunk + 1];
+            upper.reserve(chunk_capacity);
+
+            auto middle = full.begin() + chunk_capacity / 2;
+            upper.insert(upper.end(), std::make_move_iterator(middle), std::make_move_iterator(full.end()));
+            full.erase(middle, full.end());
+        }
+
+        index_type chunks;
+        size_type count = 0;
+        Compare compare;
+};
+
+} //end of namespace sw
+
+#endif
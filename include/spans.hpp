@@ -0,0 +1,39 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#ifndef CLUSTERBENCH_SPANS
+#define CLUSTERBENCH_SPANS
+
+#include <vector>
+
+#include "plf_colony.h"
+
+// Call f(first, last) on the maximal contiguous runs of elements of a
+// container, in iteration order, so that kernels can be written as plain
+// pointer loops. f returns false to stop the traversal early. Only the
+// containers that know their runs have an overload.
+
+template<typename T, typename Allocator, typename Function>
+void for_each_span(std::vector<T, Allocator>& c, Function f){
+    if(!c.empty()){
+        f(c.data(), c.data() + c.size());
+    }
+}
+
+// colony finds its runs from the skipfield of each group. for_each_run has no
+// early exit, once f returned false the remaining runs are only skipped.
+template<typename T, typename Allocator, typename Skipfield, bool Intrusive, typename Function>
+void for_each_span(plf::colony<T, Allocator, Skipfield, Intrusive>& c, Function f){
+    bool running = true;
+    c.for_each_run([&](T* first, T* last){
+        if(running){
+            running = f(first, last);
+        }
+    });
+}
+
+#endif
@@ -0,0 +1,172 @@
+//=======================================================================
+// Copyright (c) swan-gh
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Type erased containers of fixed stride elements. The element size is a
+// runtime parameter and elements are raw, zero initialised, byte slots, so a
+// single instantiation covers every size of a sweep. Each container mirrors
+// the layout of one of the benchmarked containers: contiguous, node based
+// and chunked.
+
+#ifndef CLUSTERBENCH_STRIDE
+#define CLUSTERBENCH_STRIDE
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace sw {
+
+// Slots in one contiguous buffer, handles are indices
+class stride_vector {
+    public:
+        using handle_type = std::size_t;
+
+        explicit stride_vector(std::size_t stride) : slot_stride(stride) {}
+
+        handle_type push_back(){
+            bytes.resize(bytes.size() + slot_stride);
+            return size() - 1;
+        }
+
+        std::byte* at(handle_type handle){ return bytes.data() + handle * slot_stride; }
+
+        template<typename Function>
+        void for_each(Function f){
+            for(std::size_t offset = 0; offset < bytes.size(); offset += slot_stride){
+                f(bytes.data() + offset);
+            }
+        }
+
+        std::size_t size() const { return bytes.size() / slot_stride; }
+        std::size_t stride() const { return slot_stride; }
+
+    private:
+        std::vector<std::byte> bytes;
+        std::size_t slot_stride;
+};
+
+// One heap node per slot in a doubly linked list, handles are slot pointers
+class stride_list {
+    public:
+        using handle_type = std::byte*;
+
+        explicit stride_list(std::size_t stride) : slot_stride(stride) {}
+
+        ~stride_list(){
+            for(node* n = head; n != nullptr;){
+                node* next = n->next;
+                ::operator delete(n);
+                n = next;
+            }
+        }
+
+        stride_list(const stride_list&) = delete;
+        stride_list& operator=(const stride_list&) = delete;
+
+        stride_list(stride_list&& rhs) noexcept
+            : head(rhs.head), tail(rhs.tail), count(rhs.count), slot_stride(rhs.slot_stride)
+        {
+            rhs.head = rhs.tail = nullptr;
+            rhs.count = 0;
+        }
+
+        handle_type push_back(){
+            node* n = static_cast<node*>(::operator new(sizeof(node) + slot_stride));
+            n->next = nullptr;
+            n->prev = tail;
+            std::memset(n->slot(), 0, slot_stride);
+
+            if(tail != nullptr){
+                tail->next = n;
+            } else {
+                head = n;
+            }
+            tail = n;
+            ++count;
+
+            return n->slot();
+        }
+
+        std::byte* at(handle_type handle){ return handle; }
+
+        template<typename Function>
+        void for_each(Function f){
+            for(node* n = head; n != nullptr; n = n->next){
+                f(n->slot());
+            }
+        }
+
+        std::size_t size() const { return count; }
+        std::size_t stride() const { return slot_stride; }
+
+    private:
+        // the two links keep the slot aligned like operator new
+        struct node {
+            node* next;
+            node* prev;
+
+            std::byte* slot(){ return reinterpret_cast<std::byte*>(this + 1); }
+        };
+
+        node* head = nullptr;
+        node* tail = nullptr;
+        std::size_t count = 0;
+        std::size_t slot_stride;
+};
+
+// Slots in fixed size chunks that are never moved, handles are slot pointers.
+// A chunk holds at least one slot when the stride exceeds ChunkBytes.
+template<std::size_t ChunkBytes = 16384>
+class stride_chunk_vector {
+    public:
+        using handle_type = std::byte*;
+
+        explicit stride_chunk_vector(std::size_t stride)
+            : slot_stride(stride)
+            , chunk_slots(stride < ChunkBytes ? ChunkBytes / stride : 1)
+        {}
+
+        handle_type push_back(){
+            if(count % chunk_slots == 0){
+                chunks.emplace_back(new std::byte[chunk_slots * slot_stride]());
+            }
+
+            std::byte* slot = chunks.back().get() + (count % chunk_slots) * slot_stride;
+            ++count;
+            return slot;
+        }
+
+        std::byte* at(handle_type handle){ return handle; }
+
+        template<typename Function>
+        void for_each(Function f){
+            std::size_t remaining = count;
+            for(auto& chunk : chunks){
+                std::size_t slots = remaining < chunk_slots ? remaining : chunk_slots;
+                for(std::size_t i = 0; i < slots; ++i){
+                    f(chunk.get() + i * slot_stride);
+                }
+                remaining -= slots;
+            }
+        }
+
+        std::size_t size() const { return count; }
+        std::size_t stride() const { return slot_stride; }
+        std::size_t chunk_count() const { return chunks.size(); }
+
+    private:
+        std::vector<std::unique_ptr<std::byte[]>> chunks;
+        std::size_t count = 0;
+        std::size_t slot_stride;
+        std::size_t chunk_slots;
+};
+
+} //end of namespace sw
+
+#endif
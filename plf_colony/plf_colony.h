@@ -121,9 +121,7 @@
 	#include <type_traits> // std::is_trivially_destructible, etc
 #endif
 
-#ifdef PLF_COLONY_MOVE_SEMANTICS_SUPPORT
-	#include <utility> // std::move
-#endif
+#include <utility> // std::move, std::make_pair
 
 #ifdef PLF_COLONY_INITIALIZER_LIST_SUPPORT
 	#include <initializer_list>
@@ -135,8 +133,9 @@ namespace plf
 {
 
 
-template <class element_type, class element_allocator_type = std::allocator<element_type>, typename element_skipfield_type = unsigned short > class colony : private element_allocator_type  // Empty base class optimisation - inheriting allocator functions
+template <class element_type, class element_allocator_type = std::allocator<element_type>, typename element_skipfield_type = unsigned short, bool intrusive_free_list = false > class colony : private element_allocator_type  // Empty base class optimisation - inheriting allocator functions
 // Note: unsigned short is equivalent to uint_least16_t ie. Using 16-bit integer in best-case scenario, > or < 16-bit integer in case where platform doesn't support 16-bit types
+// Note: intrusive_free_list keeps erased locations in per-group free lists threaded through the erased elements' own memory instead of in the reduced_stack - element_type must be at least as large as skipfield_type
 {
 public:
 	// Standard container typedefs:
@@ -177,6 +176,13 @@ public:
 
 private:
 
+	// The intrusive free list stores the link to the next erased location in place of the element:
+	#ifdef PLF_COLONY_ALLOCATOR_TRAITS_SUPPORT // C++11
+		static_assert(!intrusive_free_list || sizeof(element_type) >= sizeof(skipfield_type), "plf::colony: intrusive_free_list requires element_type to be at least as large as skipfield_type");
+	#else
+		typedef char intrusive_free_list_requires_element_type_at_least_as_large_as_skipfield_type[(!intrusive_free_list || sizeof(element_type) >= sizeof(skipfield_type)) ? 1 : -1];
+	#endif
+
 
 	struct group; // forward declaration for typedefs below
 
@@ -591,8 +597,34 @@ private:
 
 
 
+	// Per-group free list of erased locations, intrusive_free_list only. The index of the next erased location is stored in the memory of the erased element itself, the group only holds the head of its list and its links in the list of groups with erasures (see erased_groups):
+	template <bool has_free_list, int dummy = 0> struct free_list_links
+	{};
+
+	template <int dummy> struct free_list_links<true, dummy>
+	{
+		group_pointer_type					next_erasures_group, previous_erasures_group;
+		skipfield_type						free_list_head; // index of the most recently erased location in the group, free_list_end() if there is none
+
+		free_list_links() PLF_COLONY_NOEXCEPT:
+			next_erasures_group(NULL),
+			previous_erasures_group(NULL),
+			free_list_head(std::numeric_limits<skipfield_type>::max())
+		{}
+	};
+
+	template <bool flag> struct free_list_tag
+	{};
+
+	static inline skipfield_type free_list_end() PLF_COLONY_NOEXCEPT
+	{ // A group can hold at most max() elements so max() is never a valid index:
+		return std::numeric_limits<skipfield_type>::max();
+	}
+
+
+
 	// Colony groups:
-	struct group : private uchar_allocator_type	// Empty base class optimisation - inheriting allocator functions
+	struct group : private element_allocator_type, public free_list_links<intrusive_free_list>	// Empty base class optimisation - inheriting allocator functions - allocating in units of element_type keeps over-aligned types aligned - the free list links are empty unless intrusive_free_list
 	{
 		element_pointer_type				last_endpoint; // the address that is one past the highest cell number that's been used so far in this group - does not change with erase command - is necessary because an iterator cannot access the colony's end_iterator - also used to determine whether erasures have occured in the group by negating 'elements' and comparing with 'number_of_elements' - useful for some functions
 		group_pointer_type					next_group;
@@ -607,7 +639,7 @@ private:
 
 		#ifdef PLF_COLONY_VARIADICS_SUPPORT
 			group(const skipfield_type elements_per_group, group_pointer_type const previous = NULL):
-				last_endpoint(reinterpret_cast<element_pointer_type>(PLF_COLONY_ALLOCATE_INITIALIZATION(uchar_allocator_type, ((elements_per_group * (sizeof(element_type))) + ((elements_per_group + 1) * sizeof(skipfield_type))), (previous == NULL) ? 0 : previous->elements))), /* allocating to here purely because it is first in the struct sequence - actual pointer is elements, last_endpoint is simply initialised to element's base value initially */
+				last_endpoint(reinterpret_cast<element_pointer_type>(PLF_COLONY_ALLOCATE_INITIALIZATION(element_allocator_type, allocation_units(elements_per_group), (previous == NULL) ? 0 : previous->elements))), /* allocating to here purely because it is first in the struct sequence - actual pointer is elements, last_endpoint is simply initialised to element's base value initially */
 				next_group(NULL),
 				elements(last_endpoint++),
 				skipfield(reinterpret_cast<skipfield_pointer_type>(elements + elements_per_group)),
@@ -623,7 +655,7 @@ private:
 		#else
 			// This is a hack around the fact that element_allocator_type::construct only supports copy construction in C++03 and copy elision does not occur on the vast majority of compilers in this circumstance. And to avoid running out of memory (and performance loss) from allocating the same block twice, we're allocating in this constructor and moving data in the copy constructor.
 			group(const skipfield_type elements_per_group, group_pointer_type const previous = NULL):
-				last_endpoint(reinterpret_cast<element_pointer_type>(PLF_COLONY_ALLOCATE_INITIALIZATION(uchar_allocator_type, ((elements_per_group * (sizeof(element_type))) + ((elements_per_group + 1) * sizeof(skipfield_type))), (previous == NULL) ? 0 : previous->elements))), /* allocating to here purely because it is first in the struct sequence - actual pointer is elements, last_endpoint is simply initialised to element's base value initially */
+				last_endpoint(reinterpret_cast<element_pointer_type>(PLF_COLONY_ALLOCATE_INITIALIZATION(element_allocator_type, allocation_units(elements_per_group), (previous == NULL) ? 0 : previous->elements))), /* allocating to here purely because it is first in the struct sequence - actual pointer is elements, last_endpoint is simply initialised to element's base value initially */
 				next_group(NULL),
 				elements(NULL),
 				skipfield(reinterpret_cast<skipfield_pointer_type>(last_endpoint + elements_per_group)),
@@ -639,7 +671,7 @@ private:
 
 			// Not a real copy constructor ie. actually a move constructor. Only used for allocator.construct in C++03 for reasons stated above:
 			group(const group &source) PLF_COLONY_NOEXCEPT:
-				uchar_allocator_type(source),
+				element_allocator_type(source),
 				last_endpoint(source.last_endpoint + 1),
 				next_group(NULL),
 				elements(source.last_endpoint),
@@ -656,7 +688,15 @@ private:
 		~group() PLF_COLONY_NOEXCEPT
 		{
 			// Null check not necessary (for copied group as above) as delete will ignore.
-			PLF_COLONY_DEALLOCATE(uchar_allocator_type, (*this), reinterpret_cast<uchar_pointer_type>(elements), (size * sizeof(element_type)) + ((size + 1) * sizeof(skipfield_type)));
+			PLF_COLONY_DEALLOCATE(element_allocator_type, (*this), elements, allocation_units(size));
+		}
+
+
+
+		// Number of element_type sized units holding the elements followed by the skipfield
+		static size_type allocation_units(const skipfield_type elements_per_group) PLF_COLONY_NOEXCEPT
+		{
+			return elements_per_group + ((static_cast<size_type>(elements_per_group) + 1) * sizeof(skipfield_type) + sizeof(element_type) - 1) / sizeof(element_type);
 		}
 	};
 
@@ -1043,7 +1083,7 @@ public:
 
 
 
-		inline PLF_COLONY_FORCE_INLINE pointer * operator -> () const PLF_COLONY_NOEXCEPT
+		inline PLF_COLONY_FORCE_INLINE pointer operator -> () const PLF_COLONY_NOEXCEPT
 		{
 			return the_iterator.element_pointer;
 		}
@@ -1066,7 +1106,7 @@ public:
 				element_pointer -= 1 + *skipfield_pointer;
 				skipfield_pointer -= *skipfield_pointer;
 
-				if (!(element_pointer == group_pointer->elements - 1 && group_pointer->previous_group == NULL)) // ie. iterator is not == rend()
+				if (element_pointer != group_pointer->elements - 1) // ie. the skipped elements did not reach the beginning of the group
 				{
 					return *this;
 				}
@@ -1081,8 +1121,8 @@ public:
 			}
 			else // necessary so that reverse_iterator can end up == rend() ie. first_group->elements[-1], if we were already at first element in colony
 			{
-				--element_pointer;
-				--skipfield_pointer;
+				element_pointer = group_pointer->elements - 1;
+				skipfield_pointer = group_pointer->skipfield - 1;
 			}
 
 			return *this;
@@ -1263,6 +1303,7 @@ private:
 	}						group_allocator_pair;
 
 	reduced_stack erased_locations;
+	group_pointer_type		erased_groups; // intrusive_free_list only: groups with a non-empty free list, the group which most recently had its first erasure comes first. Reinsertion drains the first group before moving on to the next one, so that consecutive insertions stay close in memory
 
 
 public:
@@ -1274,7 +1315,8 @@ public:
 		total_number_of_elements(0),
 		min_elements_per_group((sizeof(element_type) * 8 > (sizeof(*this) + sizeof(group)) * 2) ? 8 : (((sizeof(*this) + sizeof(group)) * 2) / sizeof(element_type)) + 1),
 		group_allocator_pair(std::numeric_limits<skipfield_type>::max()),
-		erased_locations((min_elements_per_group >> 7) + 8)
+		erased_locations((min_elements_per_group >> 7) + 8),
+		erased_groups(NULL)
 	{
 	 	assert(std::numeric_limits<skipfield_type>::is_integer & !std::numeric_limits<skipfield_type>::is_signed); // skipfield type must be of unsigned integer type (uchar, ushort, uint etc)
 	}
@@ -1288,7 +1330,8 @@ public:
 		total_number_of_elements(0),
 		min_elements_per_group((sizeof(element_type) * 8 > (sizeof(*this) + sizeof(group)) * 2) ? 8 : (((sizeof(*this) + sizeof(group)) * 2) / sizeof(element_type)) + 1),
 		group_allocator_pair(std::numeric_limits<skipfield_type>::max()),
-		erased_locations((min_elements_per_group >> 7) + 8)
+		erased_locations((min_elements_per_group >> 7) + 8),
+		erased_groups(NULL)
 	{
 	 	assert(std::numeric_limits<skipfield_type>::is_integer & !std::numeric_limits<skipfield_type>::is_signed); // skipfield type must be of unsigned integer type (uchar, ushort, uint etc)
 	}
@@ -1302,7 +1345,8 @@ public:
 		total_number_of_elements(0),
 		min_elements_per_group((source.min_elements_per_group > source.total_number_of_elements) ? source.min_elements_per_group : ((source.total_number_of_elements > source.group_allocator_pair.max_elements_per_group) ? source.group_allocator_pair.max_elements_per_group : source.total_number_of_elements)), // Make the first colony group size the greater of min_elements_per_group or total_number_of_elements, so long as total_number_of_elements isn't larger than max_elements_per_group
 		group_allocator_pair(source.group_allocator_pair.max_elements_per_group),
-		erased_locations(source.erased_locations.group_allocator_pair.min_elements_per_group)
+		erased_locations(source.erased_locations.group_allocator_pair.min_elements_per_group),
+		erased_groups(NULL)
 	{
 		insert(source.begin_iterator, source.end_iterator);
 		min_elements_per_group = source.min_elements_per_group; // reset to correct value for future clear() or erasures
@@ -1317,7 +1361,8 @@ public:
 		total_number_of_elements(0),
 		min_elements_per_group((source.min_elements_per_group > source.total_number_of_elements) ? source.min_elements_per_group : ((source.total_number_of_elements > source.group_allocator_pair.max_elements_per_group) ? source.group_allocator_pair.max_elements_per_group : source.total_number_of_elements)),
 		group_allocator_pair(source.group_allocator_pair.max_elements_per_group),
-		erased_locations(source.erased_locations.group_allocator_pair.min_elements_per_group)
+		erased_locations(source.erased_locations.group_allocator_pair.min_elements_per_group),
+		erased_groups(NULL)
 	{
 		insert(source.begin_iterator, source.end_iterator);
 		min_elements_per_group = source.min_elements_per_group;
@@ -1336,9 +1381,11 @@ public:
 			total_number_of_elements(source.total_number_of_elements),
 			min_elements_per_group(source.min_elements_per_group),
 			group_allocator_pair(source.group_allocator_pair.max_elements_per_group),
-			erased_locations(std::move(source.erased_locations))
+			erased_locations(std::move(source.erased_locations)),
+			erased_groups(source.erased_groups)
 		{
 			source.first_group = NULL;
+			source.erased_groups = NULL;
 			source.total_number_of_elements = 0; // Nullifying the other data members is unnecessary - technically all can be removed except first_group NULL and total_number_of_elements 0, to allow for clean destructor usage
 		}
 		
@@ -1352,9 +1399,11 @@ public:
 			total_number_of_elements(source.total_number_of_elements),
 			min_elements_per_group(source.min_elements_per_group),
 			group_allocator_pair(source.group_allocator_pair.max_elements_per_group),
-			erased_locations(std::move(source.erased_locations))
+			erased_locations(std::move(source.erased_locations)),
+			erased_groups(source.erased_groups)
 		{
 			source.first_group = NULL;
+			source.erased_groups = NULL;
 			source.total_number_of_elements = 0; // Nullifying the other data members is unnecessary - technically all can be removed except first_group NULL and total_number_of_elements 0, to allow for clean destructor usage
 		}
 	#endif
@@ -1370,7 +1419,8 @@ public:
 		min_elements_per_group((min_allocation_amount != 0) ? min_allocation_amount : 
 			(fill_number > max_allocation_amount) ? max_allocation_amount : static_cast<skipfield_type>(fill_number)),
 		group_allocator_pair(max_allocation_amount),
-		erased_locations((min_elements_per_group < 8) ? min_elements_per_group : (min_elements_per_group >> 7) + 8)
+		erased_locations((min_elements_per_group < 8) ? min_elements_per_group : (min_elements_per_group >> 7) + 8),
+		erased_groups(NULL)
 	{
 	 	assert(std::numeric_limits<skipfield_type>::is_integer & !std::numeric_limits<skipfield_type>::is_signed);
 		assert((min_elements_per_group > 2) & (min_elements_per_group <= group_allocator_pair.max_elements_per_group));
@@ -1389,7 +1439,8 @@ public:
 		total_number_of_elements(0),
 		min_elements_per_group(min_allocation_amount),
 		group_allocator_pair(max_allocation_amount),
-		erased_locations((min_allocation_amount < 8) ? min_allocation_amount : (min_allocation_amount >> 7) + 8)
+		erased_locations((min_allocation_amount < 8) ? min_allocation_amount : (min_allocation_amount >> 7) + 8),
+		erased_groups(NULL)
 	{
 	 	assert(std::numeric_limits<skipfield_type>::is_integer & !std::numeric_limits<skipfield_type>::is_signed);
 		assert((min_elements_per_group > 2) & (min_elements_per_group <= group_allocator_pair.max_elements_per_group));
@@ -1410,7 +1461,8 @@ public:
 				(element_list.size() < 8) ? 8 :
 				(element_list.size() > max_allocation_amount) ? max_allocation_amount : static_cast<skipfield_type>(element_list.size())),
 			group_allocator_pair(max_allocation_amount),
-			erased_locations((min_elements_per_group < 8) ? min_elements_per_group : (min_elements_per_group >> 7) + 8)
+			erased_locations((min_elements_per_group < 8) ? min_elements_per_group : (min_elements_per_group >> 7) + 8),
+			erased_groups(NULL)
 		{
 		 	assert(std::numeric_limits<skipfield_type>::is_integer & !std::numeric_limits<skipfield_type>::is_signed);
 			assert((min_elements_per_group > 2) & (min_elements_per_group <= group_allocator_pair.max_elements_per_group));
@@ -1473,7 +1525,8 @@ public:
 
 	inline reverse_iterator rend() const PLF_COLONY_NOEXCEPT 
 	{
-		return reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		// elements[-1] of the first group, whether or not its first elements have been erased:
+		return (begin_iterator.group_pointer == NULL) ? reverse_iterator(NULL, NULL, NULL) : reverse_iterator(begin_iterator.group_pointer, begin_iterator.group_pointer->elements - 1, begin_iterator.group_pointer->skipfield - 1);
 	}
 
 
@@ -1487,7 +1540,118 @@ public:
 
 	inline const_reverse_iterator crend() const PLF_COLONY_NOEXCEPT
 	{
-		return const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.element_pointer - 1, begin_iterator.skipfield_pointer - 1);
+		// elements[-1] of the first group, whether or not its first elements have been erased:
+		return (begin_iterator.group_pointer == NULL) ? const_reverse_iterator(NULL, NULL, NULL) : const_reverse_iterator(begin_iterator.group_pointer, begin_iterator.group_pointer->elements - 1, begin_iterator.group_pointer->skipfield - 1);
+	}
+
+
+
+	// Segmented iteration: calls function(first, last) with pointers bounding each maximal run of consecutive non-erased elements, in iteration order, so the caller's inner loop is a plain pointer loop instead of operator ++'s skipfield jumps.
+	// Each group's skipfield is read once - a group without erasures is a single run and its skipfield is not read at all.
+	template <class function_type>
+	void for_each_run(function_type function)
+	{
+		for (group_pointer_type current_group = begin_iterator.group_pointer; current_group != NULL; current_group = current_group->next_group)
+		{
+			element_pointer_type const elements = current_group->elements;
+			const skipfield_type used = static_cast<skipfield_type>(current_group->last_endpoint - elements);
+
+			if (current_group->number_of_elements == 0) // a group kept after the colony was emptied holds no run
+			{
+				continue;
+			}
+
+			if (current_group->number_of_elements == used) // no erasures in this group
+			{
+				function(&*elements, &*elements + used);
+				continue;
+			}
+
+			const skipfield_pointer_type skipfield = current_group->skipfield;
+			skipfield_type index = *skipfield; // the first node of a skipblock holds the length of the block
+
+			while (index < used)
+			{
+				const skipfield_type run_start = index;
+
+				while (index != used && skipfield[index] == 0)
+				{
+					++index;
+				}
+
+				function(&*elements + run_start, &*elements + index);
+
+				if (index != used)
+				{
+					index += skipfield[index];
+				}
+			}
+		}
+	}
+
+
+
+	// Partitioning: writes at most 'parts' consecutive, non-empty std::pair<iterator, iterator> ranges covering the whole colony, of near-equal element count, to the output iterator 'ranges'.
+	// Setup is O(groups) - whole groups are skipped using their element counts, and a boundary falling inside a group is placed in proportion to the group's used cells then moved to the next non-erased element in O(1) using the skipfield, so no elements are walked. Counts are exact in groups without erasures and approximate otherwise.
+	template <class output_iterator_type>
+	void partition(const size_type parts, output_iterator_type ranges)
+	{
+		if (total_number_of_elements == 0 || parts == 0)
+		{
+			return;
+		}
+
+		iterator range_start = begin_iterator;
+		group_pointer_type current_group = begin_iterator.group_pointer;
+		size_type elements_before = 0; // non-erased elements in the groups preceding current_group
+
+		for (size_type part = 1; part != parts; ++part)
+		{
+			const size_type target = (total_number_of_elements * part) / parts; // index of the first element of this part, always < total_number_of_elements
+
+			while (elements_before + current_group->number_of_elements <= target)
+			{
+				elements_before += current_group->number_of_elements;
+				current_group = current_group->next_group;
+			}
+
+			const skipfield_type used = static_cast<skipfield_type>(current_group->last_endpoint - current_group->elements);
+			const skipfield_pointer_type skipfield = current_group->skipfield;
+			skipfield_type index = static_cast<skipfield_type>(((target - elements_before) * used) / current_group->number_of_elements);
+
+			if (skipfield[index] != 0) // erased - jump past the skipblock. Its start node holds the block length, and any other node of the block holds its offset from the start + 1
+			{
+				const skipfield_type block_start = (index == 0 || skipfield[index - 1] == 0) ? index : static_cast<skipfield_type>(index + 1 - skipfield[index]);
+				index = static_cast<skipfield_type>(block_start + skipfield[block_start]);
+			}
+
+			iterator boundary;
+
+			if (index != used)
+			{
+				boundary = iterator(current_group, current_group->elements + index, skipfield + index);
+			}
+			else if (current_group->next_group != NULL) // the rest of the group is erased
+			{
+				const group_pointer_type next_group = current_group->next_group;
+				boundary = iterator(next_group, next_group->elements + *(next_group->skipfield), next_group->skipfield + *(next_group->skipfield));
+			}
+			else
+			{
+				boundary = end_iterator;
+			}
+
+			if (boundary != range_start)
+			{
+				*ranges++ = std::make_pair(range_start, boundary);
+				range_start = boundary;
+			}
+		}
+
+		if (range_start != end_iterator)
+		{
+			*ranges++ = std::make_pair(range_start, end_iterator);
+		}
 	}
 
 
@@ -1592,7 +1756,7 @@ public:
 	{
 		if (end_iterator.element_pointer != NULL)
 		{
-			switch(((erased_locations.total_number_of_elements != 0) << 1) | (end_iterator.element_pointer == reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield)))
+			switch((has_erased_locations() << 1) | (end_iterator.element_pointer == reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield)))
 			{
 				case 0: // ie. erased_locations is empty and end_iterator is not at end of current final group
 				{
@@ -1648,19 +1812,17 @@ public:
 				}
 				default: // ie. erased_locations is not empty, reuse previous-erased element locations
 				{
-					iterator new_location;
-					new_location.element_pointer = *erased_locations.top_element;
-					PLF_COLONY_CONSTRUCT(element_allocator_type, (*this), new_location.element_pointer, element);
-					erased_locations.pop();
-
-					new_location.group_pointer = end_iterator.group_pointer; // Start with last group first, as will be the largest group
+					iterator new_location = pop_erased_location();
 
-					while (new_location.element_pointer < new_location.group_pointer->elements || new_location.element_pointer >= reinterpret_cast<element_pointer_type>(new_location.group_pointer->skipfield))
+					try
 					{
-						new_location.group_pointer = new_location.group_pointer->previous_group;
+						PLF_COLONY_CONSTRUCT(element_allocator_type, (*this), new_location.element_pointer, element);
+					}
+					catch (...)
+					{
+						push_erased_location(new_location.group_pointer, new_location.element_pointer);
+						throw;
 					}
-
-					new_location.skipfield_pointer = new_location.group_pointer->skipfield + (new_location.element_pointer - new_location.group_pointer->elements);
 
 					++(new_location.group_pointer->number_of_elements);
 
@@ -1751,7 +1913,7 @@ public:
 		{
 			if (end_iterator.element_pointer != NULL)
 			{
-				switch(((erased_locations.total_number_of_elements != 0) << 1) | (end_iterator.element_pointer == reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield)))
+				switch((has_erased_locations() << 1) | (end_iterator.element_pointer == reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield)))
 				{
 					case 0:
 					{
@@ -1806,19 +1968,17 @@ public:
 					}
 					default:
 					{
-						iterator new_location;
-						new_location.element_pointer = *erased_locations.top_element;
-						PLF_COLONY_CONSTRUCT(element_allocator_type, (*this), new_location.element_pointer, std::move(element));
-						erased_locations.pop();
-	
-						new_location.group_pointer = end_iterator.group_pointer; // Start with last group first, as will be the largest group
-				
-						while (new_location.element_pointer < new_location.group_pointer->elements || new_location.element_pointer >= reinterpret_cast<element_pointer_type>(new_location.group_pointer->skipfield))
+						iterator new_location = pop_erased_location();
+
+						try
 						{
-							new_location.group_pointer = new_location.group_pointer->previous_group;
+							PLF_COLONY_CONSTRUCT(element_allocator_type, (*this), new_location.element_pointer, std::move(element));
+						}
+						catch (...)
+						{
+							push_erased_location(new_location.group_pointer, new_location.element_pointer);
+							throw;
 						}
-	
-						new_location.skipfield_pointer = new_location.group_pointer->skipfield + (new_location.element_pointer - new_location.group_pointer->elements);
 
 						++(new_location.group_pointer->number_of_elements);
 
@@ -1892,7 +2052,7 @@ public:
 			{
 				if (end_iterator.element_pointer != NULL)
 				{
-					switch(((erased_locations.total_number_of_elements != 0) << 1) | (end_iterator.element_pointer == reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield)))
+					switch((has_erased_locations() << 1) | (end_iterator.element_pointer == reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield)))
 					{
 						case 0:
 						{
@@ -1943,19 +2103,17 @@ public:
 						}
 						default:
 						{
-							iterator new_location;
-							new_location.element_pointer = *erased_locations.top_element;
-							PLF_COLONY_CONSTRUCT(element_allocator_type, (*this), new_location.element_pointer, std::forward<Arguments>(parameters)...);
-							erased_locations.pop();
-	
-							new_location.group_pointer = end_iterator.group_pointer;
-	
-							while (new_location.element_pointer < new_location.group_pointer->elements || new_location.element_pointer >= reinterpret_cast<element_pointer_type>(new_location.group_pointer->skipfield))
+							iterator new_location = pop_erased_location();
+
+							try
 							{
-								new_location.group_pointer = new_location.group_pointer->previous_group;
+								PLF_COLONY_CONSTRUCT(element_allocator_type, (*this), new_location.element_pointer, std::forward<Arguments>(parameters)...);
+							}
+							catch (...)
+							{
+								push_erased_location(new_location.group_pointer, new_location.element_pointer);
+								throw;
 							}
-	
-							new_location.skipfield_pointer = new_location.group_pointer->skipfield + (new_location.element_pointer - new_location.group_pointer->elements);
 	
 							++(new_location.group_pointer->number_of_elements);
 	
@@ -2129,7 +2287,7 @@ public:
 		{
 			const iterator return_iterator = insert(element);
 			size_type num_elements = number_of_elements - 1;
-			size_type capacity_available = (reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer) + erased_locations.total_number_of_elements;
+			size_type capacity_available = (reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer) + number_of_erased_locations();
 
 			// Use up erased locations and remainder of current group first:
 			while (capacity_available-- != 0 && num_elements-- != 0)
@@ -2206,7 +2364,160 @@ public:
 
 private:
 
-	void consolidate_erased_locations(const group_pointer_type the_group_pointer)
+	inline bool has_erased_locations() const PLF_COLONY_NOEXCEPT
+	{
+		return (intrusive_free_list) ? erased_groups != NULL : erased_locations.total_number_of_elements != 0;
+	}
+
+
+
+	inline size_type number_of_erased_locations() const PLF_COLONY_NOEXCEPT
+	{
+		return number_of_erased_locations(free_list_tag<intrusive_free_list>());
+	}
+
+
+
+	inline size_type number_of_erased_locations(free_list_tag<false>) const PLF_COLONY_NOEXCEPT
+	{
+		return static_cast<size_type>(erased_locations.total_number_of_elements);
+	}
+
+
+
+	size_type number_of_erased_locations(free_list_tag<true>) const PLF_COLONY_NOEXCEPT
+	{ // Every location below last_endpoint which does not hold an element is in its group's free list:
+		size_type count = 0;
+
+		for (group_pointer_type current_group = erased_groups; current_group != NULL; current_group = current_group->next_erasures_group)
+		{
+			count += static_cast<size_type>(current_group->last_endpoint - current_group->elements) - current_group->number_of_elements;
+		}
+
+		return count;
+	}
+
+
+
+	inline PLF_COLONY_FORCE_INLINE void push_erased_location(const group_pointer_type the_group_pointer, const element_pointer_type location)
+	{
+		push_erased_location(the_group_pointer, location, free_list_tag<intrusive_free_list>());
+	}
+
+
+
+	inline PLF_COLONY_FORCE_INLINE void push_erased_location(const group_pointer_type, const element_pointer_type location, free_list_tag<false>)
+	{
+		erased_locations.push(location);
+	}
+
+
+
+	inline PLF_COLONY_FORCE_INLINE void push_erased_location(const group_pointer_type the_group_pointer, const element_pointer_type location, free_list_tag<true>) PLF_COLONY_NOEXCEPT
+	{
+		const skipfield_type next_location = the_group_pointer->free_list_head;
+		std::memcpy(static_cast<void *>(&*location), &next_location, sizeof(skipfield_type));
+		the_group_pointer->free_list_head = static_cast<skipfield_type>(location - the_group_pointer->elements);
+
+		if (next_location == free_list_end()) // First erasure in the group, put the group first in the list so that it is reused next:
+		{
+			the_group_pointer->previous_erasures_group = NULL;
+			the_group_pointer->next_erasures_group = erased_groups;
+
+			if (erased_groups != NULL)
+			{
+				erased_groups->previous_erasures_group = the_group_pointer;
+			}
+
+			erased_groups = the_group_pointer;
+		}
+	}
+
+
+
+	// Take an erased location for reuse, the caller constructs the element and pushes the location back if that throws:
+	inline PLF_COLONY_FORCE_INLINE iterator pop_erased_location()
+	{
+		return pop_erased_location(free_list_tag<intrusive_free_list>());
+	}
+
+
+
+	iterator pop_erased_location(free_list_tag<false>)
+	{
+		iterator location;
+		location.element_pointer = *erased_locations.top_element;
+		erased_locations.pop();
+
+		location.group_pointer = end_iterator.group_pointer; // Start with last group first, as will be the largest group
+
+		while (location.element_pointer < location.group_pointer->elements || location.element_pointer >= reinterpret_cast<element_pointer_type>(location.group_pointer->skipfield))
+		{
+			location.group_pointer = location.group_pointer->previous_group;
+		}
+
+		location.skipfield_pointer = location.group_pointer->skipfield + (location.element_pointer - location.group_pointer->elements);
+		return location;
+	}
+
+
+
+	inline PLF_COLONY_FORCE_INLINE iterator pop_erased_location(free_list_tag<true>) PLF_COLONY_NOEXCEPT
+	{ // No search for the group of the location is needed, it is the first group with erasures:
+		const group_pointer_type the_group_pointer = erased_groups;
+		const skipfield_type index = the_group_pointer->free_list_head;
+		const iterator location(the_group_pointer, the_group_pointer->elements + index, the_group_pointer->skipfield + index);
+
+		std::memcpy(&the_group_pointer->free_list_head, static_cast<const void *>(&*location.element_pointer), sizeof(skipfield_type));
+
+		if (the_group_pointer->free_list_head == free_list_end())
+		{
+			remove_erasures_group(the_group_pointer);
+		}
+
+		return location;
+	}
+
+
+
+	inline PLF_COLONY_FORCE_INLINE void remove_erasures_group(const group_pointer_type the_group_pointer) PLF_COLONY_NOEXCEPT
+	{
+		if (the_group_pointer->previous_erasures_group != NULL)
+		{
+			the_group_pointer->previous_erasures_group->next_erasures_group = the_group_pointer->next_erasures_group;
+		}
+		else
+		{
+			erased_groups = the_group_pointer->next_erasures_group;
+		}
+
+		if (the_group_pointer->next_erasures_group != NULL)
+		{
+			the_group_pointer->next_erasures_group->previous_erasures_group = the_group_pointer->previous_erasures_group;
+		}
+	}
+
+
+
+	inline void consolidate_erased_locations(const group_pointer_type the_group_pointer)
+	{
+		consolidate_erased_locations(the_group_pointer, free_list_tag<intrusive_free_list>());
+	}
+
+
+
+	inline void consolidate_erased_locations(const group_pointer_type the_group_pointer, free_list_tag<true>) PLF_COLONY_NOEXCEPT
+	{ // The erased locations of the group are all in its own free list, unlinking the group is enough:
+		if (the_group_pointer->free_list_head != free_list_end())
+		{
+			remove_erasures_group(the_group_pointer);
+			the_group_pointer->free_list_head = free_list_end();
+		}
+	}
+
+
+
+	void consolidate_erased_locations(const group_pointer_type the_group_pointer, free_list_tag<false>)
 	{
 		// Function: Remove all entries in the stack containing memory locations from the supplied colony group, and incidentally remove unused trailing groups from the stack.
 
@@ -2499,7 +2810,7 @@ public:
 
 		if (the_group_pointer->number_of_elements-- != 1) // ie. non-empty group at this point in time, don't consolidate - optimization note: GCC optimizes postfix + 1 comparison better than prefix + 1 comparison in many cases.
 		{
-			erased_locations.push(the_iterator.element_pointer);
+			push_erased_location(the_group_pointer, the_iterator.element_pointer);
 
 			// Code logic for following section:
 			// ---------------------------------
@@ -2603,7 +2914,15 @@ public:
 			{
 				// Reset skipfield and erased_locations rather than clearing - leads to fewer allocations/deallocations:
 				std::memset(&*(the_group_pointer->skipfield), 0, sizeof(skipfield_type) * the_group_pointer->size); // &* to avoid problems with non-trivial pointers - size + 1 to allow for computationally-faster operator ++ and other operations - extra field is unused but checked - not having it will result in out-of-bounds checks
-				erased_locations.clear();
+
+				if (intrusive_free_list)
+				{
+					consolidate_erased_locations(the_group_pointer); // The group is kept, its free list has to be reset
+				}
+				else
+				{
+					erased_locations.clear();
+				}
 
 				// Reset begin_iterator:
 				end_iterator.element_pointer = begin_iterator.element_pointer = the_group_pointer->last_endpoint = the_group_pointer->elements;
@@ -2691,7 +3010,7 @@ public:
 						PLF_COLONY_DESTROY(element_allocator_type, (*this), current.element_pointer); // Destruct element
 					}
 
-        			erased_locations.push(current.element_pointer);
+        			push_erased_location(current.group_pointer, current.element_pointer);
 
 					++current.skipfield_pointer;
 					current.element_pointer += 1 + *current.skipfield_pointer;
@@ -2814,7 +3133,7 @@ public:
 					PLF_COLONY_DESTROY(element_allocator_type, (*this), current_element);
 				}
 
-				erased_locations.push(current_element);
+				push_erased_location(current.group_pointer, current_element);
 
 				++current_skipfield;
 				current_element += 1 + *current_skipfield;
@@ -2923,7 +3242,7 @@ public:
 
 	inline size_type capacity() const PLF_COLONY_NOEXCEPT
 	{
-		return (first_group == NULL) ? 0 : (total_number_of_elements + static_cast<size_type>(erased_locations.total_number_of_elements) +
+		return (first_group == NULL) ? 0 : (total_number_of_elements + number_of_erased_locations() +
 			static_cast<size_type>(reinterpret_cast<element_pointer_type>(end_iterator.group_pointer->skipfield) - end_iterator.element_pointer));
 	}
 
@@ -2997,6 +3316,7 @@ public:
 	{
 		destroy_all_data();
 		erased_locations.clear();
+		erased_groups = NULL;
 		total_number_of_elements = 0;
 		begin_iterator.group_pointer = NULL;
 		begin_iterator.element_pointer = NULL;
@@ -3041,8 +3361,10 @@ public:
 			group_allocator_pair.max_elements_per_group = source.group_allocator_pair.max_elements_per_group;
 
 			erased_locations = std::move(source.erased_locations);
+			erased_groups = source.erased_groups;
 
 			source.first_group = NULL;
+			source.erased_groups = NULL;
 			source.total_number_of_elements = 0; // Nullifying the other data members is unnecessary - technically all can be removed except first_group NULL and total_number_of_elements 0, to allow for clean destructor usage
 			return *this;
 		}
@@ -3150,13 +3472,14 @@ public:
 			*this = std::move(temp);
 		#else
 			const iterator				swap_end_iterator = end_iterator, swap_begin_iterator = begin_iterator;
-			const group_pointer_type		swap_first_group = first_group;
+			const group_pointer_type		swap_first_group = first_group, swap_erased_groups = erased_groups;
 			const size_type				swap_total_number_of_elements = total_number_of_elements;
 			const skipfield_type 			swap_min_elements_per_group = min_elements_per_group, swap_max_elements_per_group = group_allocator_pair.max_elements_per_group;
 
 			end_iterator = source.end_iterator;
 			begin_iterator = source.begin_iterator;
 			first_group = source.first_group;
+			erased_groups = source.erased_groups;
 			total_number_of_elements = source.total_number_of_elements;
 			min_elements_per_group = source.min_elements_per_group;
 			group_allocator_pair.max_elements_per_group = source.group_allocator_pair.max_elements_per_group;
@@ -3164,6 +3487,7 @@ public:
 			source.end_iterator = swap_end_iterator;
 			source.begin_iterator = swap_begin_iterator;
 			source.first_group = swap_first_group;
+			source.erased_groups = swap_erased_groups;
 			source.total_number_of_elements = swap_total_number_of_elements;
 			source.min_elements_per_group = swap_min_elements_per_group;
 			source.group_allocator_pair.max_elements_per_group = swap_max_elements_per_group;
@@ -3886,8 +4210,8 @@ public:
 
 
 
-template <class element_type, class element_allocator_type, typename element_skipfield_type>
-inline void swap (colony<element_type, element_allocator_type, element_skipfield_type> &a, colony<element_type, element_allocator_type, element_skipfield_type> &b) PLF_COLONY_NOEXCEPT_SWAP(element_allocator_type)
+template <class element_type, class element_allocator_type, typename element_skipfield_type, bool intrusive_free_list>
+inline void swap (colony<element_type, element_allocator_type, element_skipfield_type, intrusive_free_list> &a, colony<element_type, element_allocator_type, element_skipfield_type, intrusive_free_list> &b) PLF_COLONY_NOEXCEPT_SWAP(element_allocator_type)
 {
 	a.swap(b);
 }
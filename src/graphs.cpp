@@ -15,8 +15,8 @@
 std::shared_ptr<graphs::graph> current_graph;
 std::vector<std::shared_ptr<graphs::graph>> all_graphs;
 
-void graphs::new_graph(const std::string& graph_name, const std::string& graph_title, const std::string& unit){
-    current_graph = std::make_shared<graph>(graph_name, graph_title, unit);
+void graphs::new_graph(const std::string& graph_name, const std::string& graph_title, const std::string& unit, const std::string& axis){
+    current_graph = std::make_shared<graph>(graph_name, graph_title, unit, axis);
     all_graphs.push_back(current_graph);
 
     std::cout << "Start " << graph_name << std::endl;
@@ -28,6 +28,10 @@ void graphs::new_result(const std::string& serie, const std::string& group, std:
     std::cout << serie << ":" << group << ":" << value << std::endl;
 }
 
+const std::vector<graphs::result>& graphs::current_results(){
+    return current_graph->results;
+}
+
 std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> compute_values(std::shared_ptr<graphs::graph> graph){
     std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> results;
 
@@ -98,7 +102,7 @@ void graphs::output(Output output){
                  << "title: \"" << graph->title << "\","
                  << "animation: {duration:1200, easing:\"in\"},"
                  << "width: 700, height: 400,"
-                 << "hAxis: {title:\"Number of elements\", slantedText:true},"
+                 << "hAxis: {title:\"" << graph->axis << "\", slantedText:true},"
                  << "vAxis: {viewWindow: {min:0}, title:\"" << graph->unit << "\"}};" << std::endl
                  << "graph.draw(data, options);" << std::endl;
 
@@ -144,7 +148,7 @@ void graphs::output(Output output){
         //One function to rule them all
         for(auto& graph : all_graphs){
             file << "[line_chart width=\"700px\" height=\"400px\" scale_button=\"true\" title=\"" << graph->title
-                << "\" h_title=\"Number of elements\" v_title=\"" << graph->unit << "\"]" << std::endl;
+                << "\" h_title=\"" << graph->axis << "\" v_title=\"" << graph->unit << "\"]" << std::endl;
 
             //['x', 'Cats', 'Blanket 1', 'Blanket 2'],
             auto results = compute_values(graph);
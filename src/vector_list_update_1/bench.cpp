@@ -20,10 +20,28 @@
 #include <memory>
 #include <set>
 #include <unordered_set>
+#include <execution>
+#include <numeric>
+#include <memory_resource>
+#include <cstdio>
+#include <tuple>
 
 #include "plf_colony.h"
 
 #include "bench.hpp"
+#include "aligned_alloc.hpp"
+#include "sorted_chunk_vector.hpp"
+#include "concurrent_cluster_map.hpp"
+#include "spans.hpp"
+#include "prefetch.hpp"
+#include "interleave.hpp"
+#include "stride.hpp"
+#include "soa_cluster.hpp"
+#include "mapped_cluster.hpp"
+#include "colony_tuning.hpp"
+#include "poly_cluster.hpp"
+#include "allocators.hpp"
+#include "cluster_ext.hpp"
 #include "policies.hpp"
 
 #include <ClusterVector.h>
@@ -37,22 +55,49 @@ namespace sw
 
         void* allocate(size_t n)
         {
-            return _aligned_malloc(n, 8);
+            return aligned_malloc(n, 8);
         }
 
+        // p + alignmentOffset is aligned, alignment must be a power of two
         void* allocate(size_t n, size_t alignment, size_t alignmentOffset)
         {
             if ((alignmentOffset % alignment) == 0)
             {
-                return _aligned_malloc(n, alignment);
+                return aligned_malloc(n, alignment);
             }
 
-            return NULL;
+            return aligned_offset_malloc(n, alignment, alignmentOffset % alignment);
         }
 
         void deallocate(void* p, size_t n)
         {
-            _aligned_free(p);
+            aligned_free(p);
+        }
+    };
+
+    // Forwards to default_allocator and counts the allocations and bytes
+    class counting_chunk_allocator
+    {
+    public:
+
+        void* allocate(size_t n)
+        {
+            ++allocation_count();
+            allocated_bytes() += n;
+            return default_allocator().allocate(n);
+        }
+
+        void* allocate(size_t n, size_t alignment, size_t alignmentOffset)
+        {
+            ++allocation_count();
+            allocated_bytes() += n;
+            return default_allocator().allocate(n, alignment, alignmentOffset);
+        }
+
+        void deallocate(void* p, size_t n)
+        {
+            allocated_bytes() -= n;
+            default_allocator().deallocate(p, n);
         }
     };
 }
@@ -126,6 +171,63 @@ struct Trivial<sizeof(std::size_t)> {
     bool operator<(const Trivial &other) const { return a < other.a; }
 };
 
+// trivial type with float position and velocity, padded to size N
+template<int N>
+struct Particle {
+    std::size_t a;
+    float position[3];
+    float velocity[3];
+    std::array<unsigned char, N-sizeof(a)-6*sizeof(float)> b;
+    bool operator<(const Particle &other) const { return a < other.a; }
+};
+
+template<>
+struct Particle<sizeof(std::size_t) + 6*sizeof(float)> {
+    std::size_t a;
+    float position[3];
+    float velocity[3];
+    bool operator<(const Particle &other) const { return a < other.a; }
+};
+
+// float vector aligned for SIMD loads, a follows the lanes so any alignment
+// padding shows in sizeof
+template<int Lanes, int Align>
+struct alignas(Align) FloatVector {
+    float v[Lanes];
+    std::size_t a;
+
+    // same layout without the over-alignment
+    using packed = FloatVector<Lanes, alignof(std::size_t)>;
+
+    FloatVector() = default;
+    FloatVector(std::size_t a) : v(), a(a) {}
+    bool operator<(const FloatVector &other) const { return a < other.a; }
+};
+
+// record filling exactly one cache line
+struct alignas(64) CacheLine {
+    std::size_t a;
+    std::array<unsigned char, 64 - sizeof(a)> b;
+    bool operator<(const CacheLine &other) const { return a < other.a; }
+};
+
+// polymorphic scene objects, each final type of size N updates differently
+struct PolyBase {
+    std::size_t a;
+
+    PolyBase(std::size_t a) : a(a) {}
+    virtual ~PolyBase() = default;
+    virtual void update() = 0;
+};
+
+template<int N>
+struct PolyDerived final : PolyBase {
+    std::array<unsigned char, N - sizeof(PolyBase)> b;
+
+    PolyDerived(std::size_t a) : PolyBase(a), b() {}
+    void update() override { a = a * N + 1; }
+};
+
 // non trivial, quite expensive to copy but easy to move (noexcept not set)
 class NonTrivialStringMovable {
     private:
@@ -183,6 +285,19 @@ using TrivialLarge   = Trivial<128>;     static_assert(is_trivial_of_size<Trivia
 using TrivialHuge    = Trivial<1024>;    static_assert(is_trivial_of_size<TrivialHuge>(1024),      "Invalid type");
 using TrivialMonster = Trivial<4*1024>;  static_assert(is_trivial_of_size<TrivialMonster>(4*1024), "Invalid type");
 
+using ParticleSmall  = Particle<32>;      static_assert(is_trivial_of_size<ParticleSmall>(32),       "Invalid type");
+using ParticleMedium = Particle<64>;      static_assert(is_trivial_of_size<ParticleMedium>(64),      "Invalid type");
+using ParticleLarge  = Particle<128>;     static_assert(is_trivial_of_size<ParticleLarge>(128),      "Invalid type");
+using ParticleHuge   = Particle<1024>;    static_assert(is_trivial_of_size<ParticleHuge>(1024),      "Invalid type");
+
+using PolySmall      = PolyDerived<32>;    static_assert(sizeof(PolySmall) == 32,    "Invalid type");
+using PolyMedium     = PolyDerived<64>;    static_assert(sizeof(PolyMedium) == 64,   "Invalid type");
+using PolyLarge      = PolyDerived<128>;   static_assert(sizeof(PolyLarge) == 128,   "Invalid type");
+
+using Float4         = FloatVector<4, 32>; static_assert(is_trivial_of_size<Float4>(32) && alignof(Float4) == 32,        "Invalid type");
+using Float8         = FloatVector<8, 32>; static_assert(is_trivial_of_size<Float8>(64) && alignof(Float8) == 32,        "Invalid type");
+using CacheLineSized = CacheLine;          static_assert(is_trivial_of_size<CacheLineSized>(64) && alignof(CacheLineSized) == 64, "Invalid type");
+
 static_assert(is_non_trivial_nothrow_movable<NonTrivialStringMovableNoExcept>(), "Invalid type");
 static_assert(is_non_trivial_non_nothrow_movable<NonTrivialStringMovable>(), "Invalid type");
 
@@ -203,6 +318,23 @@ using ClusterVectorHandleBench = ClusterContainerBenchType< sw::cluster_vector<T
 template<typename T>
 using ClusterMapHandleBench = ClusterContainerBenchType< sw::cluster_map<T, sw::default_allocator>, typename sw::cluster_map<T, sw::default_allocator>::handle_type >;
 
+// struct of arrays layout of the Trivial types, the hot field a then the padding
+template<typename T>
+struct soa_of;
+
+template<int N>
+struct soa_of<Trivial<N>> {
+    using type = sw::soa_cluster<std::size_t, std::array<unsigned char, N - sizeof(std::size_t)>>;
+};
+
+template<>
+struct soa_of<Trivial<sizeof(std::size_t)>> {
+    using type = sw::soa_cluster<std::size_t>;
+};
+
+template<typename T>
+using SoaHandleBench = ContainerBenchType<typename soa_of<T>::type, typename soa_of<T>::type::handle_type>;
+
 // Define all benchmarks
 
 template<typename T>
@@ -257,6 +389,50 @@ struct bench_sequential_write {
     }
 };
 
+// colony iterators against for_each_run, on a dense colony and on one with a
+// quarter of its elements erased
+template<typename T>
+struct bench_colony_runs {
+    template<template<class> class Iterate, template<class> class Runs>
+    static void run_series(const char * testName){
+        new_graph<T>(testName, "us");
+
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, Iterate>(testName, "colony", sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, Runs>(testName, "colony_runs", sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomHoles, Iterate>(testName, "colony_holes", sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomHoles, Runs>(testName, "colony_holes_runs", sizes);
+    }
+
+    static void run(){
+        run_series<IterateRead, IterateReadRuns>("colony_runs_read");
+        run_series<Write, WriteRuns>("colony_runs_write");
+    }
+};
+
+template<typename T>
+struct bench_reverse {
+    template<template<class> class Test>
+    static void run_series(const char * testName){
+        new_graph<T>(testName, "us");
+
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<T>, microseconds, FilledRandom, Test>(testName, "vector", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, Test>(testName, "list",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, Test>(testName, "deque",  sizes);
+
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, Test>(testName, "colony",  sizes);
+        bench<sw::cluster_vector<T, sw::default_allocator>, microseconds, FilledRandom, Test>(testName, "cluster_vector",  sizes);
+        bench<sw::cluster_map<T, sw::default_allocator>, microseconds, FilledRandomInsert, Test>(testName, "cluster_map",  sizes);
+    }
+
+    static void run(){
+        run_series<ReverseIterateRead>("reverse_read");
+        run_series<ReverseWrite>("reverse_write");
+        run_series<Reverse>("reverse_in_place");
+    }
+};
+
 template<typename T>
 struct bench_random_read {
     static void run(){
@@ -274,6 +450,75 @@ struct bench_random_read {
     }
 };
 
+template<typename T>
+struct bench_random_read_prefetch {
+    static void run(){
+        const char * testName = "random_read_prefetch";
+        new_graph<T>(testName, "us");
+
+        // 64 MiB to 512 MiB, past the last level cache for every element size
+        auto sizes = { working_set<T>(64), working_set<T>(128), working_set<T>(256), working_set<T>(512) };
+        bench<VectorHandleBench<T>, microseconds, FilledRandomIntegerIndexable, RandomReadIntegerIndex>(testName, "vector", sizes);
+        bench<VectorHandleBench<T>, microseconds, PrefetchTuned<FilledRandomIntegerIndexable, GatherIntegerIndex>::Create, GatherIntegerIndex>(testName, "vector_prefetch", sizes);
+        bench<ListHandleBench<T>,   microseconds, FilledRandomIterators, RandomReadIterators>(testName, "list", sizes);
+        bench<ListHandleBench<T>,   microseconds, PrefetchTuned<FilledRandomIterators, GatherIterators>::Create, GatherIterators>(testName, "list_prefetch", sizes);
+
+        bench<ColonyHandleBench<T>, microseconds, FilledRandomColony, RandomReadIterators>(testName, "colony", sizes);
+        bench<ColonyHandleBench<T>, microseconds, PrefetchTuned<FilledRandomColony, GatherIterators>::Create, GatherIterators>(testName, "colony_prefetch", sizes);
+        bench<ClusterVectorHandleBench<T>, microseconds, FilledRandomClusterVector, RandomReadIterators>(testName, "cluster_vector", sizes);
+        bench<ClusterVectorHandleBench<T>, microseconds, PrefetchTuned<FilledRandomClusterVector, GatherIterators>::Create, GatherIterators>(testName, "cluster_vector_prefetch", sizes);
+        bench<ClusterMapHandleBench<T>, microseconds, FilledRandomClusterMap, RandomReadClusterMap>(testName, "cluster_map",  sizes);
+        bench<ClusterMapHandleBench<T>, microseconds, PrefetchTuned<FilledRandomClusterMap, GatherClusterMap>::Create, GatherClusterMap>(testName, "cluster_map_prefetch",  sizes);
+    }
+};
+
+// Random reads with the storage mapped on 4 KiB against 2 MiB pages
+template<typename T>
+struct bench_random_read_pages {
+    template<sw::page_size Pages>
+    using VectorBench = ContainerBenchType<std::vector<T, sw::std_allocator<T, sw::page_allocator<Pages>>>, size_t>;
+    template<sw::page_size Pages>
+    using ClusterVectorBench = ClusterContainerBenchType< sw::cluster_vector<T, sw::page_allocator<Pages>>, typename sw::cluster_vector<T, sw::page_allocator<Pages>>::iterator >;
+    template<sw::page_size Pages>
+    using ClusterMapBench = ClusterContainerBenchType< sw::cluster_map<T, sw::page_allocator<Pages>>, typename sw::cluster_map<T, sw::page_allocator<Pages>>::handle_type >;
+
+    static void run(){
+        const char * testName = "random_read_pages";
+        new_graph<T>(testName, "us");
+
+        // 64 MiB to 512 MiB, past the reach of the dTLB with 4 KiB pages and
+        // within it with 2 MiB pages
+        auto sizes = { working_set<T>(64), working_set<T>(128), working_set<T>(256), working_set<T>(512) };
+        bench<VectorBench<sw::page_size::PAGES_4K>, microseconds, FilledRandomIntegerIndexable, RandomReadIntegerIndex>(testName, "vector_4k", sizes);
+        bench<VectorBench<sw::page_size::PAGES_2M>, microseconds, FilledRandomIntegerIndexable, RandomReadIntegerIndex>(testName, "vector_2m", sizes);
+
+        bench<ClusterVectorBench<sw::page_size::PAGES_4K>, microseconds, FilledRandomClusterVector, RandomReadIterators>(testName, "cluster_vector_4k", sizes);
+        bench<ClusterVectorBench<sw::page_size::PAGES_2M>, microseconds, FilledRandomClusterVector, RandomReadIterators>(testName, "cluster_vector_2m", sizes);
+        bench<ClusterMapBench<sw::page_size::PAGES_4K>, microseconds, FilledRandomClusterMap, RandomReadClusterMap>(testName, "cluster_map_4k",  sizes);
+        bench<ClusterMapBench<sw::page_size::PAGES_2M>, microseconds, FilledRandomClusterMap, RandomReadClusterMap>(testName, "cluster_map_2m",  sizes);
+    }
+};
+
+template<typename T>
+struct bench_random_read_interleaved {
+    static void run(){
+        const char * testName = "random_read_interleaved";
+        new_graph<T>(testName, "us");
+
+        // 64 MiB to 512 MiB, lookups that miss to DRAM for every element size
+        auto sizes = { working_set<T>(64), working_set<T>(128), working_set<T>(256), working_set<T>(512) };
+        bench<ListHandleBench<T>,   microseconds, FilledRandomIterators, RandomReadIterators>(testName, "list", sizes);
+        bench<ListHandleBench<T>,   microseconds, FilledRandomIterators, Interleaved<4>::Iterators>(testName, "list_interleaved_4", sizes);
+        bench<ListHandleBench<T>,   microseconds, FilledRandomIterators, Interleaved<8>::Iterators>(testName, "list_interleaved_8", sizes);
+        bench<ListHandleBench<T>,   microseconds, FilledRandomIterators, Interleaved<16>::Iterators>(testName, "list_interleaved_16", sizes);
+
+        bench<ClusterMapHandleBench<T>, microseconds, FilledRandomClusterMap, RandomReadClusterMap>(testName, "cluster_map",  sizes);
+        bench<ClusterMapHandleBench<T>, microseconds, FilledRandomClusterMap, Interleaved<4>::ClusterMap>(testName, "cluster_map_interleaved_4",  sizes);
+        bench<ClusterMapHandleBench<T>, microseconds, FilledRandomClusterMap, Interleaved<8>::ClusterMap>(testName, "cluster_map_interleaved_8",  sizes);
+        bench<ClusterMapHandleBench<T>, microseconds, FilledRandomClusterMap, Interleaved<16>::ClusterMap>(testName, "cluster_map_interleaved_16",  sizes);
+    }
+};
+
 template<typename T>
 struct bench_random_write {
     static void run(){
@@ -291,15 +536,620 @@ struct bench_random_write {
     }
 };
 
+// Destruction of prebuilt containers. For trivially destructible elements the
+// *_bulk clusters take their chunks from sw::arena_allocator: releasing a chunk
+// is a counter decrement and the last one rewinds the arena in one step,
+// instead of one free per chunk.
+template<typename T>
+struct bench_destroy {
+    static void run(){
+        const char * testName = "destroy";
+        new_graph<T>(testName, "us");
+
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<T>, microseconds, BackupSmartFilled, SmartDelete>(testName, "vector", sizes);
+        bench<std::list<T>,   microseconds, BackupSmartFilled, SmartDelete>(testName, "list",   sizes);
+        bench<std::deque<T>,  microseconds, BackupSmartFilled, SmartDelete>(testName, "deque",  sizes);
+
+        bench<plf::colony<T>, microseconds, BackupSmartFilledInsert, SmartDelete>(testName, "colony",  sizes);
+        bench<sw::cluster_vector<T, sw::default_allocator>, microseconds, BackupSmartFilled, SmartDelete>(testName, "cluster_vector",  sizes);
+        bench<sw::cluster_map<T, sw::default_allocator>, microseconds, BackupSmartFilledInsert, SmartDelete>(testName, "cluster_map",  sizes);
+
+        if constexpr(std::is_trivially_destructible<T>::value){
+            bench<sw::cluster_vector<T, sw::arena_allocator>, microseconds, BackupSmartFilled, SmartDelete>(testName, "cluster_vector_bulk",  sizes);
+            bench<sw::cluster_map<T, sw::arena_allocator>, microseconds, BackupSmartFilledInsert, SmartDelete>(testName, "cluster_map_bulk",  sizes);
+        }
+    }
+};
+
+// Every container is split once with partition() when it is created, outside
+// of the timed region, and the ranges are handed out to the pool. list and
+// deque are split by walking their iterators, colony on its groups.
+// vector_par lets std::execution::par choose its threads, it is the reference.
+template<typename T>
+struct bench_parallel {
+    template<typename Container>
+    using Split = PartitionedBenchType<Container>;
+
+    template<template<class> class Operation, template<class> class StdOperation>
+    static void run_series(const char * testName){
+        new_graph<T>(testName, "us", "Number of threads");
+
+        // large enough to be memory bound at every element size
+        const std::size_t size = (128u << 20) / sizeof(T);
+        auto threads = thread_counts();
+
+        bench_threads_reference<std::vector<T>, microseconds, FilledRandom, StdOperation>("vector_par", size, threads);
+        bench_threads<Split<std::vector<T>>, microseconds, Partitioned<FilledRandom>::Create, Operation>("vector", size, threads);
+        bench_threads<Split<std::list<T>>,   microseconds, Partitioned<FilledRandom>::Create, Operation>("list",   size, threads);
+        bench_threads<Split<std::deque<T>>,  microseconds, Partitioned<FilledRandom>::Create, Operation>("deque",  size, threads);
+
+        bench_threads<Split<plf::colony<T>>, microseconds, Partitioned<FilledRandomInsert>::Create, Operation>("colony",  size, threads);
+    }
+
+    static void run(){
+        run_series<ParallelRead, StdParallelRead>("parallel_read");
+        run_series<ParallelWrite, StdParallelWrite>("parallel_write");
+        run_series<ParallelTransform, StdParallelTransform>("parallel_transform");
+    }
+};
+
+// colony configurations swept by bench_colony_tuning
+template<typename Skipfield, std::size_t MinGroup, std::size_t MaxGroup>
+struct ColonyConfig {
+    template<typename T>
+    using colony = sw::sized_colony<T, Skipfield, MinGroup, MaxGroup>;
+
+    static std::string label(){
+        return "u" + std::to_string(8 * sizeof(Skipfield)) + "_" + std::to_string(MinGroup) + "_" + std::to_string(MaxGroup);
+    }
+};
+
+enum class ColonyWorkload {
+    FILL,
+    ITERATE,
+    CHURN
+};
+
+// time of each configuration relative to the fastest one, for fill, iterate,
+// churn and their sum, one row per element size
+struct colony_tuning_scores {
+    std::size_t element_size;
+    std::vector<std::string> labels;
+    std::vector<std::vector<double>> relative;
+};
+
+inline std::vector<colony_tuning_scores>& colony_tuning_table(){
+    static std::vector<colony_tuning_scores> table;
+    return table;
+}
+
+// One graph per workload over the element sizes of the sweep, in percent of
+// the fastest configuration, the recommended configuration is the lowest serie
+inline void output_colony_recommendations(){
+    const char * names[] = { "colony_tuning_fill_relative", "colony_tuning_iterate_relative", "colony_tuning_churn_relative", "colony_tuning_overall" };
+    for(std::size_t w = 0; w < 4; ++w){
+        graphs::new_graph(names[w], names[w], "% of the fastest", "Element size (bytes)");
+        for(auto& row : colony_tuning_table()){
+            for(std::size_t i = 0; i < row.labels.size(); ++i){
+                graphs::new_result(row.labels[i], std::to_string(row.element_size), static_cast<std::size_t>(row.relative[w][i] * 100 + 0.5));
+            }
+        }
+    }
+}
+
+// Sweep of the colony skipfield type and group sizes over fill, iterate and
+// churn. Each configuration is scored by its time summed over the sizes,
+// overall by the sum over the workloads of its time relative to the best
+// configuration of that workload.
+template<typename T>
+struct bench_colony_tuning {
+    using Configs = std::tuple<
+        ColonyConfig<std::uint8_t, 8, 255>,
+        ColonyConfig<std::uint8_t, 255, 255>,
+        ColonyConfig<std::uint16_t, 8, 1024>,
+        ColonyConfig<std::uint16_t, 8, 8192>,
+        ColonyConfig<std::uint16_t, 8, 65535>,
+        ColonyConfig<std::uint16_t, 1024, 1024>,
+        ColonyConfig<std::uint16_t, 8192, 8192>,
+        ColonyConfig<std::uint32_t, 8, 262144>,
+        ColonyConfig<std::uint32_t, 8, 1048576>,
+        ColonyConfig<std::uint32_t, 65536, 65536>>;
+
+    template<typename Colony>
+    static void run_workload(ColonyWorkload workload, const char * testName, const std::string& type, const std::initializer_list<int>& sizes){
+        if(workload == ColonyWorkload::FILL){
+            bench<Colony, microseconds, Empty, InsertSimple>(testName, type, sizes);
+        } else if(workload == ColonyWorkload::ITERATE){
+            bench<Colony, microseconds, FilledRandomInsert, IterateRead>(testName, type, sizes);
+        } else {
+            bench<ContainerBenchType<Colony, typename Colony::iterator>, microseconds, FilledRandomColony, Churn>(testName, type, sizes);
+        }
+    }
+
+    static std::vector<std::string> labels(){
+        return std::apply([](auto... config){ return std::vector<std::string>{ decltype(config)::label()... }; }, Configs());
+    }
+
+    // time of each configuration of the current graph, summed over the sizes
+    static std::vector<double> totals(){
+        std::vector<double> result;
+        for(auto& label : labels()){
+            std::size_t total = 0;
+            for(auto& r : graphs::current_results()){
+                if(r.serie == label){
+                    total += r.value;
+                }
+            }
+            result.push_back(static_cast<double>(total));
+        }
+        return result;
+    }
+
+    static std::vector<double> run_series(ColonyWorkload workload, const char * testName){
+        new_graph<T>(testName, "us");
+
+        auto sizes = { 10000, 100000, 1000000 };
+        run_workload<plf::colony<T>>(workload, testName, "default", sizes);
+        std::apply([&](auto... config){
+            (run_workload<typename decltype(config)::template colony<T>>(workload, testName, decltype(config)::label(), sizes), ...);
+        }, Configs());
+        run_workload<sw::tuned_colony<T>>(workload, testName, "tuned", sizes);
+
+        return totals();
+    }
+
+    static void run(){
+        std::vector<std::vector<double>> workloads = {
+            run_series(ColonyWorkload::FILL, "colony_tuning_fill"),
+            run_series(ColonyWorkload::ITERATE, "colony_tuning_iterate"),
+            run_series(ColonyWorkload::CHURN, "colony_tuning_churn")
+        };
+
+        std::vector<std::vector<double>> relative;
+        std::vector<double> overall(labels().size(), 0.0);
+        for(auto& scores : workloads){
+            double fastest = std::max(1.0, *std::min_element(scores.begin(), scores.end()));
+            std::vector<double> row;
+            for(std::size_t i = 0; i < scores.size(); ++i){
+                row.push_back(scores[i] / fastest);
+                overall[i] += scores[i] / fastest;
+            }
+            relative.push_back(row);
+        }
+        relative.push_back(overall);
+
+        colony_tuning_table().push_back({ sizeof(T), labels(), relative });
+    }
+};
+
+// colony with its erased locations in the stock reduced_stack against the
+// intrusive per-group free lists, on partial churn (a quarter of the elements
+// erased and reinserted) and full churn (every group released), with the
+// default groups and with groups capped at 1024 elements. The footprint is
+// taken with a quarter erased and after the partial churn.
+template<typename T>
+struct bench_colony_free_list {
+    template<bool Intrusive>
+    using Colony = plf::colony<T, std::allocator<T>, unsigned short, Intrusive>;
+
+    template<bool Intrusive>
+    using SmallColony = sw::sized_colony<T, unsigned short, 8, 1024, Intrusive>;
+
+    template<bool Intrusive>
+    using CountedColony = plf::colony<T, counting_allocator<T>, unsigned short, Intrusive>;
+
+    template<typename C>
+    using Handles = ContainerBenchType<C, typename C::iterator>;
+
+    static void run(){
+        auto sizes = { 10000, 100000, 1000000 };
+
+        const char * testName = "colony_free_list_churn";
+        new_graph<T>(testName, "us");
+        bench<Handles<Colony<false>>, microseconds, FilledRandomColony, ChurnQuarter>(testName, "stack", sizes);
+        bench<Handles<Colony<true>>, microseconds, FilledRandomColony, ChurnQuarter>(testName, "intrusive", sizes);
+        bench<Handles<SmallColony<false>>, microseconds, FilledRandomColony, ChurnQuarter>(testName, "stack_1024", sizes);
+        bench<Handles<SmallColony<true>>, microseconds, FilledRandomColony, ChurnQuarter>(testName, "intrusive_1024", sizes);
+
+        testName = "colony_free_list_full_churn";
+        new_graph<T>(testName, "us");
+        bench<Handles<Colony<false>>, microseconds, FilledRandomColony, Churn>(testName, "stack", sizes);
+        bench<Handles<Colony<true>>, microseconds, FilledRandomColony, Churn>(testName, "intrusive", sizes);
+        bench<Handles<SmallColony<false>>, microseconds, FilledRandomColony, Churn>(testName, "stack_1024", sizes);
+        bench<Handles<SmallColony<true>>, microseconds, FilledRandomColony, Churn>(testName, "intrusive_1024", sizes);
+
+        testName = "colony_free_list_footprint";
+        new_graph<T>(testName, "bytes per element");
+        bench_footprint<Handles<CountedColony<false>>, After<FilledRandomColony, EraseQuarter>::Create>("stack_holes", sizes);
+        bench_footprint<Handles<CountedColony<true>>, After<FilledRandomColony, EraseQuarter>::Create>("intrusive_holes", sizes);
+        bench_footprint<Handles<CountedColony<false>>, After<FilledRandomColony, ChurnQuarter>::Create>("stack_churned", sizes);
+        bench_footprint<Handles<CountedColony<true>>, After<FilledRandomColony, ChurnQuarter>::Create>("intrusive_churned", sizes);
+    }
+};
+
+// colony split with colony::partition, scaled up to every core on 1e7
+// elements, dense and with a quarter of its elements erased
+template<typename T>
+struct bench_colony_parallel {
+    template<template<class> class Operation>
+    static void run_series(const char * testName){
+        new_graph<T>(testName, "us", "Number of threads");
+
+        const std::size_t size = 10000000;
+        auto threads = thread_counts();
+
+        bench_threads<PartitionedBenchType<std::vector<T>>, microseconds, Partitioned<FilledRandom>::Create, Operation>("vector", size, threads);
+        bench_threads<PartitionedBenchType<plf::colony<T>>, microseconds, Partitioned<FilledRandomInsert>::Create, Operation>("colony", size, threads);
+        bench_threads<PartitionedBenchType<plf::colony<T>>, microseconds, Partitioned<FilledRandomHoles>::Create, Operation>("colony_holes", size, threads);
+    }
+
+    static void run(){
+        run_series<ParallelRead>("colony_parallel_read");
+        run_series<ParallelWrite>("colony_parallel_write");
+        run_series<ParallelTransform>("colony_parallel_transform");
+    }
+};
+
+template<typename T>
+struct bench_concurrent_pool {
+    static void run_series(ConcurrentMetric metric){
+        auto threads = thread_counts();
+        bench_concurrent<LockedPool<sw::cluster_map<T, sw::default_allocator>>, MixedInsertEraseRead>("cluster_map_locked", threads, metric);
+        bench_concurrent<ShardedPool<sw::cluster_map<T, sw::default_allocator>>, MixedInsertEraseRead>("cluster_map_sharded", threads, metric);
+        bench_concurrent<ConcurrentPool<sw::concurrent_cluster_map<T>>, MixedInsertEraseRead>("concurrent_cluster_map", threads, metric);
+    }
+
+    static void run(){
+        new_graph<T>("concurrent_throughput", "operations per ms", "Number of threads");
+        run_series(ConcurrentMetric::THROUGHPUT);
+
+        new_graph<T>("concurrent_p99", "ns", "Number of threads");
+        run_series(ConcurrentMetric::P99);
+    }
+};
+
+// The span series only cover vector and colony. Spans over the cluster chunks
+// are not delivered: they need chunk access inside the Cluster containers.
+template<typename T>
+struct bench_kernels {
+    template<template<class> class Kernel, template<class> class SpanKernel>
+    static void run_series(const char * testName){
+        new_graph<T>(testName, "us");
+
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<T>, microseconds, FilledRandom, Kernel>(testName, "vector", sizes);
+        bench<std::vector<T>, microseconds, FilledRandom, SpanKernel>(testName, "vector_span", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, Kernel>(testName, "list",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, Kernel>(testName, "deque",  sizes);
+
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, Kernel>(testName, "colony",  sizes);
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, SpanKernel>(testName, "colony_span",  sizes);
+        bench<sw::cluster_vector<T, sw::default_allocator>, microseconds, FilledRandom, Kernel>(testName, "cluster_vector",  sizes);
+        bench<sw::cluster_map<T, sw::default_allocator>, microseconds, FilledRandomInsert, Kernel>(testName, "cluster_map",  sizes);
+    }
+
+    static void run(){
+        run_series<SumFields, SumFieldsSpan>("sum_fields");
+        run_series<ConditionalUpdate, ConditionalUpdateSpan>("conditional_update");
+        run_series<ReduceEarlyExit, ReduceEarlyExitSpan>("reduce_early_exit");
+    }
+};
+
+// Only for the Particle types
+template<typename T>
+struct bench_integrate {
+    static void run(){
+        bench_kernels<T>::template run_series<Integrate, IntegrateSpan>("integrate");
+    }
+};
+
+// cluster_vector against the struct of arrays cluster on workloads that only
+// touch the hot field
+template<typename T>
+struct bench_soa {
+    static void run(){
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+
+        const char * testName = "soa_sequential_read";
+        new_graph<T>(testName, "us");
+        bench<sw::cluster_vector<T, sw::default_allocator>, microseconds, FilledRandom, IterateRead>(testName, "cluster_vector",  sizes);
+        bench<SoaHandleBench<T>, microseconds, FilledRandomSoa, SoaIterateRead>(testName, "soa_cluster",  sizes);
+
+        testName = "soa_sequential_write";
+        new_graph<T>(testName, "us");
+        bench<sw::cluster_vector<T, sw::default_allocator>, microseconds, FilledRandom, Write>(testName, "cluster_vector",  sizes);
+        bench<SoaHandleBench<T>, microseconds, FilledRandomSoa, SoaWrite>(testName, "soa_cluster",  sizes);
+
+        testName = "soa_random_read";
+        new_graph<T>(testName, "us");
+        bench<ClusterVectorHandleBench<T>, microseconds, FilledRandomClusterVector, RandomReadIterators>(testName, "cluster_vector", sizes);
+        bench<SoaHandleBench<T>, microseconds, FilledRandomSoa, SoaRandomRead>(testName, "soa_cluster",  sizes);
+    }
+};
+
+// Time until a pool is usable at process start: rebuilt from scratch, or
+// reopened from a mapped file. Both end with a read pass so the pages of the
+// lazily mapped file are paid for. The file was just written, so the reopen
+// is measured with a warm page cache.
+template<typename T>
+struct bench_startup {
+    static void run(){
+        const char * testName = "startup";
+        new_graph<T>(testName, "ms");
+
+        auto sizes = { 1000000, 10000000, 100000000 };
+        bench<sw::cluster_vector<T, sw::default_allocator>, milliseconds, Rebuilt<FilledRandom>::Create, Rebuilt<FilledRandom>::Build, IterateRead>(testName, "cluster_vector_rebuild", sizes);
+        bench<sw::cluster_map<T, sw::default_allocator>, milliseconds, Rebuilt<FilledRandomInsert>::Create, Rebuilt<FilledRandomInsert>::Build, IterateRead>(testName, "cluster_map_rebuild", sizes);
+
+        bench<sw::mapped_cluster_vector<T>, milliseconds, Mapped<PushBack>::Create, Mapped<PushBack>::Reopen, IterateRead>(testName, "mapped_cluster_vector_reopen", sizes);
+        bench<sw::mapped_cluster_map<T>, milliseconds, Mapped<InsertSimple>::Create, Mapped<InsertSimple>::Reopen, IterateRead>(testName, "mapped_cluster_map_reopen", sizes);
+    }
+};
+
+// fill_back with the page faults of the timed region separated: cold on fresh
+// memory, prefaulted through sw::prefault_allocator, and warm after an
+// untimed run on recycled memory
+template<typename T>
+struct bench_fill_back_faults {
+    template<typename U>
+    using Prefault = sw::std_allocator<U, sw::prefault_allocator>;
+
+    template<template<class> class Create, template<class> class Test, typename Container, typename PrefaultContainer>
+    static void run_modes(const std::string& type, const std::initializer_list<int>& sizes, FaultMetric metric){
+        bench_faults<Container, microseconds, Create, Test>(type, sizes, metric, false);
+        bench_faults<PrefaultContainer, microseconds, Prefaulted<Create>::template Create, Test>(type + "_prefault", sizes, metric, false);
+        bench_faults<Container, microseconds, Create, Test>(type + "_warm", sizes, metric, true);
+    }
+
+    static void run_series(FaultMetric metric){
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        run_modes<Empty, PushBack, std::vector<T>, std::vector<T, Prefault<T>>>("vector", sizes, metric);
+        run_modes<Empty, PushBack, std::list<T>, std::list<T, Prefault<T>>>("list", sizes, metric);
+        run_modes<Empty, PushBack, std::deque<T>, std::deque<T, Prefault<T>>>("deque", sizes, metric);
+
+        run_modes<Empty, InsertSimple, plf::colony<T>, plf::colony<T, Prefault<T>>>("colony", sizes, metric);
+        run_modes<Empty, PushBack, sw::cluster_vector<T, sw::default_allocator>, sw::cluster_vector<T, sw::prefault_allocator>>("cluster_vector", sizes, metric);
+        run_modes<Empty, InsertSimple, sw::cluster_map<T, sw::default_allocator>, sw::cluster_map<T, sw::prefault_allocator>>("cluster_map", sizes, metric);
+    }
+
+    static void run(){
+        new_graph<T>("fill_back_faults", "us");
+        run_series(FaultMetric::LATENCY);
+
+        new_graph<T>("fill_back_minor_faults", "minor faults");
+        run_series(FaultMetric::MINOR_FAULTS);
+
+        new_graph<T>("fill_back_major_faults", "major faults");
+        run_series(FaultMetric::MAJOR_FAULTS);
+    }
+};
+
+// Every container over the default allocator then each std::pmr resource
+template<typename T>
+struct bench_pmr {
+    template<template<class> class CreatePolicy, template<class> class TestPolicy, typename Container, typename PmrContainer>
+    static void run_resources(const char* testName, const std::string& type, const std::initializer_list<int>& sizes){
+        bench<Container, microseconds, CreatePolicy, TestPolicy>(testName, type, sizes);
+        bench<PmrContainer, microseconds, WithResource<Resource::MONOTONIC, CreatePolicy>::template Create, TestPolicy>(testName, type + "_monotonic", sizes);
+        bench<PmrContainer, microseconds, WithResource<Resource::UNSYNCHRONIZED_POOL, CreatePolicy>::template Create, TestPolicy>(testName, type + "_pool", sizes);
+        bench<PmrContainer, microseconds, WithResource<Resource::SYNCHRONIZED_POOL, CreatePolicy>::template Create, TestPolicy>(testName, type + "_synchronized_pool", sizes);
+    }
+
+    template<template<class> class Create, template<class> class CreateInsert, template<class> class Push, template<class> class Insert>
+    static void run_series(const char* testName, const std::initializer_list<int>& sizes){
+        new_graph<T>(testName, "us");
+        run_resources<Create, Push, std::vector<T>, std::pmr::vector<T>>(testName, "vector", sizes);
+        run_resources<Create, Push, std::list<T>, std::pmr::list<T>>(testName, "list", sizes);
+        run_resources<Create, Push, std::deque<T>, std::pmr::deque<T>>(testName, "deque", sizes);
+
+        run_resources<CreateInsert, Insert, plf::colony<T>, plf::colony<T, std::pmr::polymorphic_allocator<T>>>(testName, "colony", sizes);
+        run_resources<Create, Push, sw::cluster_vector<T, sw::default_allocator>, sw::cluster_vector<T, sw::memory_resource_allocator>>(testName, "cluster_vector", sizes);
+        run_resources<CreateInsert, Insert, sw::cluster_map<T, sw::default_allocator>, sw::cluster_map<T, sw::memory_resource_allocator>>(testName, "cluster_map", sizes);
+    }
+
+    static void run(){
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        run_series<Empty, Empty, PushBack, InsertSimple>("pmr_fill_back", sizes);
+        run_series<FilledRandom, FilledRandomInsert, IterateRead, IterateRead>("pmr_sequential_read", sizes);
+    }
+};
+
+// Cluster containers over each chunk allocator
+template<typename T>
+struct bench_allocators {
+    template<typename Allocator>
+    using MapBench = ClusterContainerBenchType< sw::cluster_map<T, Allocator>, typename sw::cluster_map<T, Allocator>::handle_type >;
+
+    using Pool = sw::pool_allocator<>;
+
+    static void run(){
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+
+        const char * testName = "allocator_fill_back";
+        new_graph<T>(testName, "us");
+        bench<sw::cluster_vector<T, sw::default_allocator>, microseconds, Empty, PushBack>(testName, "default", sizes);
+        bench<sw::cluster_vector<T, sw::arena_allocator>, microseconds, Empty, PushBack>(testName, "arena", sizes);
+        bench<sw::cluster_vector<T, Pool>, microseconds, Empty, PushBack>(testName, "pool", sizes);
+        bench<sw::cluster_vector<T, sw::thread_cache_allocator>, microseconds, Empty, PushBack>(testName, "thread_cache", sizes);
+
+        testName = "allocator_churn";
+        new_graph<T>(testName, "us");
+        bench<MapBench<sw::default_allocator>, microseconds, FilledRandomClusterMap, Churn>(testName, "default", sizes);
+        bench<MapBench<sw::arena_allocator>, microseconds, FilledRandomClusterMap, Churn>(testName, "arena", sizes);
+        bench<MapBench<Pool>, microseconds, FilledRandomClusterMap, Churn>(testName, "pool", sizes);
+        bench<MapBench<sw::thread_cache_allocator>, microseconds, FilledRandomClusterMap, Churn>(testName, "thread_cache", sizes);
+
+        new_graph<T>("allocator_refill", "ns per frame");
+        bench_frames<sw::cluster_vector<T, sw::default_allocator>, nanoseconds, ClearPushBack>("default", sizes, FrameMetric::LATENCY);
+        bench_frames<sw::cluster_vector<T, sw::arena_allocator>, nanoseconds, ClearPushBack>("arena", sizes, FrameMetric::LATENCY);
+        bench_frames<sw::cluster_vector<T, Pool>, nanoseconds, ClearPushBack>("pool", sizes, FrameMetric::LATENCY);
+        bench_frames<sw::cluster_vector<T, sw::thread_cache_allocator>, nanoseconds, ClearPushBack>("thread_cache", sizes, FrameMetric::LATENCY);
+    }
+};
+
+// Mixed polymorphic objects behind owning pointers against one cluster per
+// dynamic type
+struct bench_polymorphic {
+    template<class Container>
+    using Filled = FilledRandomPolymorphic<PolySmall, PolyMedium, PolyLarge>::Create<Container>;
+
+    using PolyCluster = sw::poly_cluster<PolyBase, sw::default_allocator, PolySmall, PolyMedium, PolyLarge>;
+
+    static void run(){
+        const char * testName = "polymorphic_update";
+        graphs::new_graph(testName, testName, "us");
+
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<std::unique_ptr<PolyBase>>, microseconds, Filled, UpdateVirtual>(testName, "vector_unique_ptr", sizes);
+        bench<plf::colony<std::unique_ptr<PolyBase>>, microseconds, Filled, UpdateVirtual>(testName, "colony_unique_ptr", sizes);
+
+        bench<PolyCluster, microseconds, Filled, UpdateSegregatedVirtual>(testName, "poly_cluster_virtual", sizes);
+        bench<PolyCluster, microseconds, Filled, UpdateSegregated>(testName, "poly_cluster", sizes);
+    }
+};
+
+// Element size sweep over the type erased stride containers, a single
+// instantiation covers every size
+struct bench_stride {
+    template<template<class> class CreatePolicy, template<class> class TestPolicy>
+    static void run_series(const char* testName){
+        graphs::new_graph(testName, testName, "us", "Element size (bytes)");
+
+        auto strides = { 8, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192};
+        bench<StrideBenchType<sw::stride_vector>, microseconds, CreatePolicy, TestPolicy>(testName, "vector", strides);
+        bench<StrideBenchType<sw::stride_list>, microseconds, CreatePolicy, TestPolicy>(testName, "list", strides);
+        bench<StrideBenchType<sw::stride_chunk_vector<>>, microseconds, CreatePolicy, TestPolicy>(testName, "chunk_vector", strides);
+    }
+
+    static void run(){
+        run_series<EmptyStride, StrideFillBack>("stride_fill_back");
+        run_series<FilledRandomStride, StrideIterateRead>("stride_sequential_read");
+        run_series<FilledRandomStride, StrideRandomRead>("stride_random_read");
+    }
+};
+
+template<typename T>
+struct bench_sorted_insert {
+    static void run(){
+        const char * testName = "sorted_insert";
+        new_graph<T>(testName, "us");
+
+        auto sizes = { 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000};
+        bench<std::vector<T>, microseconds, Empty, RandomSortedInsert>(testName, "vector", sizes);
+        bench<std::vector<T>, microseconds, Empty, RandomSortedInsertBinary>(testName, "vector_binary", sizes);
+        bench<std::list<T>,   microseconds, Empty, RandomSortedInsert>(testName, "list",   sizes);
+        bench<std::deque<T>,  microseconds, Empty, RandomSortedInsertBinary>(testName, "deque_binary",  sizes);
+        bench<std::multiset<T>, microseconds, Empty, RandomSortedInsertOrdered>(testName, "multiset",  sizes);
+
+        bench<sw::sorted_chunk_vector<T>, microseconds, Empty, RandomSortedInsertOrdered>(testName, "sorted_chunk_vector",  sizes);
+    }
+};
+
+// Linear searches and list are left out, they do not scale to these sizes
+template<typename T>
+struct bench_sorted_insert_large {
+    static void run(){
+        const char * testName = "sorted_insert_large";
+        new_graph<T>(testName, "us");
+
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench<std::vector<T>, microseconds, Empty, RandomSortedInsertBinary>(testName, "vector_binary", sizes);
+        bench<std::deque<T>,  microseconds, Empty, RandomSortedInsertBinary>(testName, "deque_binary",  sizes);
+        bench<std::multiset<T>, microseconds, Empty, RandomSortedInsertOrdered>(testName, "multiset",  sizes);
+
+        bench<sw::sorted_chunk_vector<T>, microseconds, Empty, RandomSortedInsertOrdered>(testName, "sorted_chunk_vector",  sizes);
+    }
+};
+
+template<typename T>
+struct bench_frame_reuse {
+    static void run_series(FrameMetric metric){
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+        bench_frames<std::vector<T, counting_allocator<T>>, nanoseconds, ClearPushBack>("vector", sizes, metric);
+        bench_frames<std::list<T, counting_allocator<T>>,   nanoseconds, ClearPushBack>("list",   sizes, metric);
+        bench_frames<std::deque<T, counting_allocator<T>>,  nanoseconds, ClearPushBack>("deque",  sizes, metric);
+
+        bench_frames<plf::colony<T, counting_allocator<T>>, nanoseconds, ClearInsert>("colony",  sizes, metric);
+        bench_frames<sw::cluster_vector<T, sw::counting_chunk_allocator>, nanoseconds, ClearPushBack>("cluster_vector",  sizes, metric);
+        bench_frames<sw::cluster_map<T, sw::counting_chunk_allocator>, nanoseconds, ClearInsert>("cluster_map",  sizes, metric);
+    }
+
+    static void run(){
+        new_graph<T>("frame_reuse", "ns per frame");
+        run_series(FrameMetric::LATENCY);
+
+        new_graph<T>("frame_reuse_allocations", "allocations per frame");
+        run_series(FrameMetric::ALLOCATIONS);
+    }
+};
+
+// over-aligned float vectors against the same lanes without the alignment
+template<typename T>
+struct bench_aligned {
+    using P = typename T::packed;
+
+    static void run(){
+        auto sizes = { 10000, 20000, 30000, 40000, 50000, 60000, 70000, 80000, 90000, 100000};
+
+        const char * testName = "aligned_write";
+        new_graph<T>(testName, "us");
+        bench<std::vector<T>, microseconds, FilledRandom, WriteLanes>(testName, "vector", sizes);
+        bench<std::vector<P>, microseconds, FilledRandom, WriteLanes>(testName, "vector_packed", sizes);
+        bench<std::list<T>,   microseconds, FilledRandom, WriteLanes>(testName, "list",   sizes);
+        bench<std::list<P>,   microseconds, FilledRandom, WriteLanes>(testName, "list_packed",   sizes);
+        bench<std::deque<T>,  microseconds, FilledRandom, WriteLanes>(testName, "deque",  sizes);
+        bench<std::deque<P>,  microseconds, FilledRandom, WriteLanes>(testName, "deque_packed",  sizes);
+
+        bench<plf::colony<T>, microseconds, FilledRandomInsert, WriteLanes>(testName, "colony",  sizes);
+        bench<plf::colony<P>, microseconds, FilledRandomInsert, WriteLanes>(testName, "colony_packed",  sizes);
+        bench<sw::cluster_vector<T, sw::default_allocator>, microseconds, FilledRandom, WriteLanes>(testName, "cluster_vector",  sizes);
+        bench<sw::cluster_vector<P, sw::default_allocator>, microseconds, FilledRandom, WriteLanes>(testName, "cluster_vector_packed",  sizes);
+        bench<sw::cluster_map<T, sw::default_allocator>, microseconds, FilledRandomInsert, WriteLanes>(testName, "cluster_map",  sizes);
+        bench<sw::cluster_map<P, sw::default_allocator>, microseconds, FilledRandomInsert, WriteLanes>(testName, "cluster_map_packed",  sizes);
+
+        testName = "aligned_footprint";
+        new_graph<T>(testName, "bytes per element");
+        bench_footprint<std::vector<T, counting_allocator<T>>, FilledRandom>("vector", sizes);
+        bench_footprint<std::vector<P, counting_allocator<P>>, FilledRandom>("vector_packed", sizes);
+        bench_footprint<std::list<T, counting_allocator<T>>,   FilledRandom>("list",   sizes);
+        bench_footprint<std::list<P, counting_allocator<P>>,   FilledRandom>("list_packed",   sizes);
+        bench_footprint<std::deque<T, counting_allocator<T>>,  FilledRandom>("deque",  sizes);
+        bench_footprint<std::deque<P, counting_allocator<P>>,  FilledRandom>("deque_packed",  sizes);
+
+        bench_footprint<plf::colony<T, counting_allocator<T>>, FilledRandomInsert>("colony",  sizes);
+        bench_footprint<plf::colony<P, counting_allocator<P>>, FilledRandomInsert>("colony_packed",  sizes);
+        bench_footprint<sw::cluster_vector<T, sw::counting_chunk_allocator>, FilledRandom>("cluster_vector",  sizes);
+        bench_footprint<sw::cluster_vector<P, sw::counting_chunk_allocator>, FilledRandom>("cluster_vector_packed",  sizes);
+        bench_footprint<sw::cluster_map<T, sw::counting_chunk_allocator>, FilledRandomInsert>("cluster_map",  sizes);
+        bench_footprint<sw::cluster_map<P, sw::counting_chunk_allocator>, FilledRandomInsert>("cluster_map_packed",  sizes);
+    }
+};
+
 //Launch the benchmark
 
 template<typename ...Types>
 void bench_all(){
     bench_types<bench_fill_back,        Types...>();
+    bench_types<bench_fill_back_faults, Types...>();
     bench_types<bench_sequential_read,  Types...>();
     bench_types<bench_sequential_write, Types...>();
+    bench_types<bench_colony_runs,      Types...>();
+    bench_types<bench_reverse,          Types...>();
     bench_types<bench_random_read,      Types...>();
+    bench_types<bench_random_read_prefetch, Types...>();
+    bench_types<bench_random_read_interleaved, Types...>();
+    bench_types<bench_random_read_pages, Types...>();
     bench_types<bench_random_write,     Types...>();
+    bench_types<bench_sorted_insert,    Types...>();
+    bench_types<bench_frame_reuse,      Types...>();
+    bench_types<bench_allocators,       Types...>();
+    bench_types<bench_pmr,              Types...>();
+    bench_types<bench_parallel,         Types...>();
+    bench_types<bench_concurrent_pool,  Types...>();
+    bench_types<bench_kernels,          Types...>();
+    // include a type with a non trivial destructor
+    bench_types<bench_destroy,          Types..., NonTrivialStringMovable>();
 }
 
 int main(){
@@ -311,6 +1161,58 @@ int main(){
         TrivialHuge,
         NonTrivialArray<32> >();
 
+    // binary insertion memmoves the whole tail, past the small types a single
+    // pass over the largest size takes minutes
+    bench_types<bench_sorted_insert_large,
+        TrivialSmall,
+        TrivialMedium >();
+
+    bench_types<bench_aligned,
+        Float4,
+        Float8 >();
+
+    bench_types<bench_fill_back,
+        Float4,
+        Float8,
+        CacheLineSized >();
+
+    bench_types<bench_sequential_write,
+        Float4,
+        Float8,
+        CacheLineSized >();
+
+    bench_types<bench_integrate,
+        ParticleSmall,
+        ParticleMedium,
+        ParticleLarge,
+        ParticleHuge >();
+
+    bench_types<bench_soa,
+        TrivialSmall,
+        TrivialMedium,
+        TrivialLarge,
+        TrivialHuge >();
+
+    bench_types<bench_startup,
+        TrivialSmall >();
+
+    bench_types<bench_colony_parallel,
+        TrivialSmall,
+        TrivialMedium >();
+
+    bench_types<bench_colony_tuning,
+        TrivialSmall,
+        TrivialMedium,
+        TrivialLarge >();
+    output_colony_recommendations();
+
+    bench_types<bench_colony_free_list,
+        TrivialSmall,
+        TrivialMedium >();
+
+    bench_polymorphic::run();
+    bench_stride::run();
+
     //Generate the graphs
     graphs::output(graphs::Output::GOOGLE);
 